@@ -0,0 +1,35 @@
+//! Context creation, cloning and re-randomization.
+
+use criterion::{black_box, criterion_group, criterion_main, Criterion};
+use secp256k1::ffi::types::AlignedType;
+use secp256k1::Secp256k1;
+use secp256k1_bench::bytes32;
+
+fn create(c: &mut Criterion) {
+    let mut group = c.benchmark_group("context/create");
+    group.bench_function("all", |b| b.iter(Secp256k1::new));
+    group.bench_function("signing_only", |b| b.iter(Secp256k1::signing_only));
+    group.bench_function("verification_only", |b| b.iter(Secp256k1::verification_only));
+    let mut buf = vec![AlignedType::zeroed(); Secp256k1::preallocate_size()];
+    group.bench_function("preallocated", |b| {
+        b.iter(|| {
+            let secp = Secp256k1::preallocated_new(&mut buf).unwrap();
+            black_box(&secp);
+        })
+    });
+    group.finish();
+}
+
+fn clone(c: &mut Criterion) {
+    let secp = Secp256k1::new();
+    c.bench_function("context/clone", |b| b.iter(|| black_box(&secp).clone()));
+}
+
+fn randomize(c: &mut Criterion) {
+    let mut secp = Secp256k1::new();
+    let seed = bytes32(0);
+    c.bench_function("context/randomize", |b| b.iter(|| secp.seeded_randomize(black_box(&seed))));
+}
+
+criterion_group!(benches, create, clone, randomize);
+criterion_main!(benches);
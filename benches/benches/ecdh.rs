@@ -0,0 +1,38 @@
+//! Elliptic curve Diffie-Hellman.
+
+use criterion::{black_box, criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use secp256k1::ecdh::{self, SharedSecret};
+use secp256k1::Secp256k1;
+use secp256k1_bench::{public_keys, secret_keys, BATCH_SIZES};
+
+fn shared_secret(c: &mut Criterion) {
+    let secp = Secp256k1::new();
+    let sk = secret_keys(1)[0];
+    let pk = public_keys(&secp, 2)[1];
+
+    let mut group = c.benchmark_group("ecdh/single");
+    group.bench_function("shared_secret", |b| b.iter(|| SharedSecret::new(black_box(&pk), &sk)));
+    group.bench_function("shared_secret_point", |b| {
+        b.iter(|| ecdh::shared_secret_point(black_box(&pk), &sk))
+    });
+    group.finish();
+
+    let mut group = c.benchmark_group("ecdh/many");
+    for &n in BATCH_SIZES.iter() {
+        let pks = public_keys(&secp, n + 1).split_off(1);
+        group.throughput(Throughput::Elements(n as u64));
+        group.bench_with_input(BenchmarkId::new("loop", n), &pks, |b, pks| {
+            b.iter(|| pks.iter().map(|pk| SharedSecret::new(pk, &sk)).collect::<Vec<_>>())
+        });
+        group.bench_with_input(BenchmarkId::new("new_many", n), &pks, |b, pks| {
+            b.iter(|| SharedSecret::new_many(pks, &sk))
+        });
+        group.bench_with_input(BenchmarkId::new("shared_secret_points", n), &pks, |b, pks| {
+            b.iter(|| ecdh::shared_secret_points(pks, &sk))
+        });
+    }
+    group.finish();
+}
+
+criterion_group!(benches, shared_secret);
+criterion_main!(benches);
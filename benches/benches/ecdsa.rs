@@ -0,0 +1,96 @@
+//! ECDSA signing, verification and signature encoding.
+
+use criterion::{black_box, criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use secp256k1::ecdsa::Signature;
+use secp256k1::{PreparedPublicKey, Secp256k1};
+use secp256k1_bench::{bytes32, messages, public_keys, secret_keys, BATCH_SIZES};
+
+fn sign(c: &mut Criterion) {
+    let secp = Secp256k1::new();
+    let sk = secret_keys(1)[0];
+    let msg = messages(1)[0];
+    let noncedata = bytes32(u64::max_value());
+
+    let mut group = c.benchmark_group("ecdsa/sign");
+    group.bench_function("sign", |b| b.iter(|| secp.sign_ecdsa(black_box(&msg), &sk)));
+    group.bench_function("with_noncedata", |b| {
+        b.iter(|| secp.sign_ecdsa_with_noncedata(black_box(&msg), &sk, &noncedata))
+    });
+    group.bench_function("low_r", |b| b.iter(|| secp.sign_ecdsa_low_r(black_box(&msg), &sk)));
+    group.finish();
+
+    let mut group = c.benchmark_group("ecdsa/sign_batch");
+    for &n in BATCH_SIZES.iter() {
+        let batch: Vec<_> = messages(n).into_iter().zip(secret_keys(n)).collect();
+        group.throughput(Throughput::Elements(n as u64));
+        group.bench_with_input(BenchmarkId::new("loop", n), &batch, |b, batch| {
+            b.iter(|| batch.iter().map(|(msg, sk)| secp.sign_ecdsa(msg, sk)).collect::<Vec<_>>())
+        });
+        group.bench_with_input(BenchmarkId::new("batch", n), &batch, |b, batch| {
+            b.iter(|| secp.sign_ecdsa_batch(batch))
+        });
+    }
+    group.finish();
+}
+
+fn verify(c: &mut Criterion) {
+    let secp = Secp256k1::new();
+    let sk = secret_keys(1)[0];
+    let pk = sk.public_key(&secp);
+    let prepared = PreparedPublicKey::new(&pk);
+    let msg = messages(1)[0];
+    let sig = secp.sign_ecdsa(&msg, &sk);
+
+    let mut group = c.benchmark_group("ecdsa/verify");
+    group.bench_function("verify", |b| b.iter(|| secp.verify_ecdsa(black_box(&msg), &sig, &pk)));
+    group.bench_function("prepared", |b| {
+        b.iter(|| secp.verify_ecdsa_prepared(black_box(&msg), &sig, &prepared))
+    });
+    group.finish();
+
+    let mut group = c.benchmark_group("ecdsa/verify_batch");
+    for &n in BATCH_SIZES.iter() {
+        let msgs = messages(n);
+        let pks = public_keys(&secp, n);
+        let batch: Vec<_> = secret_keys(n)
+            .iter()
+            .zip(msgs.into_iter().zip(pks))
+            .map(|(sk, (msg, pk))| (msg, secp.sign_ecdsa(&msg, sk), pk))
+            .collect();
+        group.throughput(Throughput::Elements(n as u64));
+        group.bench_with_input(BenchmarkId::new("loop", n), &batch, |b, batch| {
+            b.iter(|| batch.iter().all(|(msg, sig, pk)| secp.verify_ecdsa(msg, sig, pk).is_ok()))
+        });
+        group.bench_with_input(BenchmarkId::new("batch", n), &batch, |b, batch| {
+            b.iter(|| secp.verify_ecdsa_batch(batch))
+        });
+    }
+    group.finish();
+}
+
+fn encoding(c: &mut Criterion) {
+    let secp = Secp256k1::new();
+    let sig = secp.sign_ecdsa(&messages(1)[0], &secret_keys(1)[0]);
+    let der = sig.serialize_der();
+    let compact = sig.serialize_compact();
+
+    let mut group = c.benchmark_group("ecdsa/encoding");
+    group.bench_function("parse_der", |b| b.iter(|| Signature::from_der(black_box(&der))));
+    group.bench_function("parse_der_lax", |b| b.iter(|| Signature::from_der_lax(black_box(&der))));
+    group.bench_function("parse_compact", |b| {
+        b.iter(|| Signature::from_compact(black_box(&compact)))
+    });
+    group.bench_function("serialize_der", |b| b.iter(|| black_box(&sig).serialize_der()));
+    group.bench_function("serialize_compact", |b| b.iter(|| black_box(&sig).serialize_compact()));
+    group.bench_function("normalize_s", |b| {
+        b.iter(|| {
+            let mut sig = black_box(sig);
+            sig.normalize_s();
+            sig
+        })
+    });
+    group.finish();
+}
+
+criterion_group!(benches, sign, verify, encoding);
+criterion_main!(benches);
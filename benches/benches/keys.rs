@@ -0,0 +1,135 @@
+//! Key derivation, parsing, serialization, tweaking and aggregation.
+
+use criterion::{black_box, criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use secp256k1::pubkey_cache::PubkeyCache;
+use secp256k1::{KeyPair, PublicKey, PublicKeyRange, Scalar, Secp256k1, SecretKey, XOnlyPublicKey};
+use secp256k1_bench::{bytes32, public_keys, secret_keys, BATCH_SIZES};
+
+fn derive(c: &mut Criterion) {
+    let secp = Secp256k1::new();
+    let sk = secret_keys(1)[0];
+
+    let mut group = c.benchmark_group("keys/derive");
+    group.bench_function("public_key", |b| b.iter(|| black_box(&sk).public_key(&secp)));
+    group.bench_function("keypair", |b| b.iter(|| black_box(&sk).keypair(&secp)));
+    let keypair = sk.keypair(&secp);
+    group.bench_function("x_only_public_key", |b| {
+        b.iter(|| black_box(&keypair).x_only_public_key())
+    });
+    group.finish();
+
+    let mut group = c.benchmark_group("keys/derive_batch");
+    for &n in BATCH_SIZES.iter() {
+        let sks = secret_keys(n);
+        let mut pks = public_keys(&secp, n);
+        group.throughput(Throughput::Elements(n as u64));
+        group.bench_with_input(BenchmarkId::new("from_secret_keys_batch", n), &sks, |b, sks| {
+            b.iter(|| PublicKey::from_secret_keys_batch(&secp, sks, &mut pks))
+        });
+        group.bench_with_input(BenchmarkId::new("range", n), &pks[0], |b, start| {
+            b.iter(|| PublicKeyRange::new(*start).take(n).last())
+        });
+    }
+    group.finish();
+}
+
+fn parse(c: &mut Criterion) {
+    let secp = Secp256k1::new();
+    let sk = secret_keys(1)[0];
+    let pk = sk.public_key(&secp);
+    let (xonly, _) = pk.x_only_public_key();
+    let sk_bytes = sk.secret_bytes();
+    let compressed = pk.serialize();
+    let uncompressed = pk.serialize_uncompressed();
+    let xonly_bytes = xonly.serialize();
+
+    let mut group = c.benchmark_group("keys/parse");
+    group.bench_function("secret_key", |b| b.iter(|| SecretKey::from_slice(black_box(&sk_bytes))));
+    group.bench_function("public_key_compressed", |b| {
+        b.iter(|| PublicKey::from_slice(black_box(&compressed)))
+    });
+    let cache = PubkeyCache::new(1024);
+    group.bench_function("public_key_compressed_cached", |b| {
+        b.iter(|| cache.parse(black_box(&compressed)))
+    });
+    group.bench_function("public_key_uncompressed", |b| {
+        b.iter(|| PublicKey::from_slice(black_box(&uncompressed)))
+    });
+    group.bench_function("x_only_public_key", |b| {
+        b.iter(|| XOnlyPublicKey::from_slice(black_box(&xonly_bytes)))
+    });
+    group.bench_function("keypair", |b| {
+        b.iter(|| KeyPair::from_seckey_slice(&secp, black_box(&sk_bytes)))
+    });
+    group.finish();
+
+    let mut group = c.benchmark_group("keys/serialize");
+    group.bench_function("public_key_compressed", |b| b.iter(|| black_box(&pk).serialize()));
+    group.bench_function("public_key_uncompressed", |b| {
+        b.iter(|| black_box(&pk).serialize_uncompressed())
+    });
+    group.bench_function("x_only_public_key", |b| b.iter(|| black_box(&xonly).serialize()));
+    group.finish();
+
+    let mut group = c.benchmark_group("keys/parse_batch");
+    for &n in BATCH_SIZES.iter() {
+        let data: Vec<_> = public_keys(&secp, n).iter().map(PublicKey::serialize).collect();
+        let mut pks = public_keys(&secp, n);
+        group.throughput(Throughput::Elements(n as u64));
+        group.bench_with_input(BenchmarkId::new("from_slice", n), &data, |b, data| {
+            b.iter(|| data.iter().map(|data| PublicKey::from_slice(data)).last())
+        });
+        group.bench_with_input(BenchmarkId::new("from_compressed_batch", n), &data, |b, data| {
+            b.iter(|| PublicKey::from_compressed_batch(data, &mut pks))
+        });
+    }
+    group.finish();
+}
+
+fn tweak(c: &mut Criterion) {
+    let secp = Secp256k1::new();
+    let sk = secret_keys(1)[0];
+    let pk = sk.public_key(&secp);
+    let keypair = sk.keypair(&secp);
+    let (xonly, _) = keypair.x_only_public_key();
+    let tweak = Scalar::from_be_bytes(bytes32(u64::max_value())).unwrap();
+    let (tweaked, parity) = xonly.add_tweak(&secp, &tweak).unwrap();
+
+    let mut group = c.benchmark_group("keys/tweak");
+    group.bench_function("secret_key_negate", |b| b.iter(|| black_box(sk).negate()));
+    group.bench_function("secret_key_add", |b| b.iter(|| black_box(sk).add_tweak(&tweak)));
+    group.bench_function("secret_key_mul", |b| b.iter(|| black_box(sk).mul_tweak(&tweak)));
+    group.bench_function("public_key_negate", |b| b.iter(|| black_box(pk).negate(&secp)));
+    group.bench_function("public_key_add", |b| {
+        b.iter(|| black_box(pk).add_exp_tweak(&secp, &tweak))
+    });
+    group.bench_function("public_key_mul", |b| b.iter(|| black_box(pk).mul_tweak(&secp, &tweak)));
+    group.bench_function("keypair_add_xonly", |b| {
+        b.iter(|| black_box(keypair).add_xonly_tweak(&secp, &tweak))
+    });
+    group.bench_function("x_only_public_key_add", |b| {
+        b.iter(|| black_box(xonly).add_tweak(&secp, &tweak))
+    });
+    group.bench_function("x_only_public_key_add_check", |b| {
+        b.iter(|| black_box(&xonly).tweak_add_check(&secp, &tweaked, parity, tweak))
+    });
+    group.finish();
+}
+
+fn combine(c: &mut Criterion) {
+    let secp = Secp256k1::new();
+
+    let mut group = c.benchmark_group("keys/combine_keys");
+    for &n in BATCH_SIZES.iter() {
+        let pks = public_keys(&secp, n);
+        let refs: Vec<&PublicKey> = pks.iter().collect();
+        group.throughput(Throughput::Elements(n as u64));
+        group.bench_with_input(BenchmarkId::from_parameter(n), &refs, |b, refs| {
+            b.iter(|| PublicKey::combine_keys(refs))
+        });
+    }
+    group.finish();
+}
+
+criterion_group!(benches, derive, parse, tweak, combine);
+criterion_main!(benches);
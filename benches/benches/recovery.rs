@@ -0,0 +1,77 @@
+//! Recoverable ECDSA signing, public key recovery and batch verification.
+
+use criterion::{black_box, criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use secp256k1::ecdsa::RecoverableSignature;
+use secp256k1::Secp256k1;
+use secp256k1_bench::{messages, secret_keys, BATCH_SIZES};
+
+fn sign(c: &mut Criterion) {
+    let secp = Secp256k1::new();
+    let sk = secret_keys(1)[0];
+    let msg = messages(1)[0];
+    let sig = secp.sign_ecdsa_recoverable(&msg, &sk);
+    let (recid, compact) = sig.serialize_compact();
+
+    let mut group = c.benchmark_group("recovery/sign");
+    group.bench_function("sign", |b| b.iter(|| secp.sign_ecdsa_recoverable(black_box(&msg), &sk)));
+    group.bench_function("parse_compact", |b| {
+        b.iter(|| RecoverableSignature::from_compact(black_box(&compact), recid))
+    });
+    group.bench_function("serialize_compact", |b| b.iter(|| black_box(&sig).serialize_compact()));
+    group.bench_function("to_standard", |b| b.iter(|| black_box(&sig).to_standard()));
+    group.finish();
+}
+
+fn recover(c: &mut Criterion) {
+    let secp = Secp256k1::new();
+    let msg = messages(1)[0];
+    let sig = secp.sign_ecdsa_recoverable(&msg, &secret_keys(1)[0]);
+    c.bench_function("recovery/recover", |b| b.iter(|| secp.recover_ecdsa(black_box(&msg), &sig)));
+
+    let mut group = c.benchmark_group("recovery/recover_batch");
+    for &n in BATCH_SIZES.iter() {
+        let batch: Vec<_> = messages(n)
+            .into_iter()
+            .zip(secret_keys(n))
+            .map(|(msg, sk)| (msg, secp.sign_ecdsa_recoverable(&msg, &sk)))
+            .collect();
+        group.throughput(Throughput::Elements(n as u64));
+        group.bench_with_input(BenchmarkId::new("loop", n), &batch, |b, batch| {
+            b.iter(|| {
+                batch.iter().map(|(msg, sig)| secp.recover_ecdsa(msg, sig)).collect::<Vec<_>>()
+            })
+        });
+        group.bench_with_input(BenchmarkId::new("batch", n), &batch, |b, batch| {
+            b.iter(|| secp.recover_ecdsa_batch(batch))
+        });
+    }
+    group.finish();
+}
+
+fn verify(c: &mut Criterion) {
+    let secp = Secp256k1::new();
+
+    let mut group = c.benchmark_group("recovery/verify_batch");
+    for &n in BATCH_SIZES.iter() {
+        let batch: Vec<_> = messages(n)
+            .into_iter()
+            .zip(secret_keys(n))
+            .map(|(msg, sk)| (msg, secp.sign_ecdsa_recoverable(&msg, &sk), sk.public_key(&secp)))
+            .collect();
+        group.throughput(Throughput::Elements(n as u64));
+        group.bench_with_input(BenchmarkId::new("loop", n), &batch, |b, batch| {
+            b.iter(|| {
+                batch
+                    .iter()
+                    .all(|(msg, sig, pk)| secp.verify_ecdsa(msg, &sig.to_standard(), pk).is_ok())
+            })
+        });
+        group.bench_with_input(BenchmarkId::new("batch", n), &batch, |b, batch| {
+            b.iter(|| secp.verify_ecdsa_recoverable_batch(batch))
+        });
+    }
+    group.finish();
+}
+
+criterion_group!(benches, sign, recover, verify);
+criterion_main!(benches);
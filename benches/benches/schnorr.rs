@@ -0,0 +1,117 @@
+//! BIP 340 signing, verification and tagged hashing.
+
+use criterion::{black_box, criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use secp256k1::schnorr::{Signature, TaggedHash};
+use secp256k1::{PreparedXOnlyPublicKey, Secp256k1};
+use secp256k1_bench::{bytes32, keypairs, messages, BATCH_SIZES};
+
+/// Lengths of the messages hashed by the tagged hash benchmarks.
+const MESSAGE_LENGTHS: [usize; 4] = [32, 64, 256, 1024];
+
+fn sign(c: &mut Criterion) {
+    let secp = Secp256k1::new();
+    let keypair = keypairs(&secp, 1)[0];
+    let msg = messages(1)[0];
+    let aux_rand = bytes32(u64::max_value());
+
+    let mut group = c.benchmark_group("schnorr/sign");
+    group.bench_function("no_aux_rand", |b| {
+        b.iter(|| secp.sign_schnorr_no_aux_rand(black_box(&msg), &keypair))
+    });
+    group.bench_function("with_aux_rand", |b| {
+        b.iter(|| secp.sign_schnorr_with_aux_rand(black_box(&msg), &keypair, &aux_rand))
+    });
+    group.finish();
+
+    let mut group = c.benchmark_group("schnorr/sign_batch");
+    for &n in BATCH_SIZES.iter() {
+        let batch: Vec<_> = messages(n).into_iter().zip(keypairs(&secp, n)).collect();
+        let aux_rands: Vec<_> = (0..n as u64).map(bytes32).collect();
+        group.throughput(Throughput::Elements(n as u64));
+        group.bench_with_input(BenchmarkId::new("loop", n), &batch, |b, batch| {
+            b.iter(|| {
+                batch
+                    .iter()
+                    .zip(&aux_rands)
+                    .map(|((msg, keypair), aux)| secp.sign_schnorr_with_aux_rand(msg, keypair, aux))
+                    .collect::<Vec<_>>()
+            })
+        });
+        group.bench_with_input(BenchmarkId::new("batch", n), &batch, |b, batch| {
+            b.iter(|| secp.sign_schnorr_batch_with_aux_rand(batch, &aux_rands))
+        });
+    }
+    group.finish();
+}
+
+fn verify(c: &mut Criterion) {
+    let secp = Secp256k1::new();
+    let keypair = keypairs(&secp, 1)[0];
+    let (pk, _) = keypair.x_only_public_key();
+    let prepared = PreparedXOnlyPublicKey::new(&pk);
+    let msg = messages(1)[0];
+    let sig = secp.sign_schnorr_no_aux_rand(&msg, &keypair);
+    let sig_bytes = sig.as_ref().to_vec();
+
+    let mut group = c.benchmark_group("schnorr/verify");
+    group.bench_function("verify", |b| b.iter(|| secp.verify_schnorr(&sig, black_box(&msg), &pk)));
+    group.bench_function("prepared", |b| {
+        b.iter(|| secp.verify_schnorr_prepared(&sig, black_box(&msg), &prepared))
+    });
+    group.bench_function("parse_signature", |b| {
+        b.iter(|| Signature::from_slice(black_box(&sig_bytes)))
+    });
+    group.finish();
+
+    let mut group = c.benchmark_group("schnorr/verify_batch");
+    for &n in BATCH_SIZES.iter() {
+        let batch: Vec<_> = messages(n)
+            .into_iter()
+            .zip(keypairs(&secp, n))
+            .map(|(msg, keypair)| {
+                let sig = secp.sign_schnorr_no_aux_rand(&msg, &keypair);
+                (msg, sig, keypair.x_only_public_key().0)
+            })
+            .collect();
+        group.throughput(Throughput::Elements(n as u64));
+        group.bench_with_input(BenchmarkId::new("loop", n), &batch, |b, batch| {
+            b.iter(|| batch.iter().all(|(msg, sig, pk)| secp.verify_schnorr(sig, msg, pk).is_ok()))
+        });
+        group.bench_with_input(BenchmarkId::new("batch", n), &batch, |b, batch| {
+            b.iter(|| secp.verify_schnorr_batch(batch))
+        });
+    }
+    group.finish();
+}
+
+fn tagged(c: &mut Criterion) {
+    let secp = Secp256k1::new();
+    let keypair = keypairs(&secp, 1)[0];
+    let (pk, _) = keypair.x_only_public_key();
+    let aux_rand = bytes32(u64::max_value());
+    let tag = TaggedHash::new(b"TapLeaf");
+
+    c.bench_function("schnorr/tagged_hash/new", |b| {
+        b.iter(|| TaggedHash::new(black_box(b"TapLeaf")))
+    });
+
+    let mut group = c.benchmark_group("schnorr/tagged_hash");
+    for &len in MESSAGE_LENGTHS.iter() {
+        let msg: Vec<u8> = (0..len).map(|i| i as u8).collect();
+        let sig = secp.sign_schnorr_tagged_with_aux_rand(&tag, &msg, &keypair, &aux_rand);
+        group.throughput(Throughput::Bytes(len as u64));
+        group.bench_with_input(BenchmarkId::new("hash", len), &msg, |b, msg| {
+            b.iter(|| tag.hash(msg))
+        });
+        group.bench_with_input(BenchmarkId::new("sign", len), &msg, |b, msg| {
+            b.iter(|| secp.sign_schnorr_tagged_with_aux_rand(&tag, msg, &keypair, &aux_rand))
+        });
+        group.bench_with_input(BenchmarkId::new("verify", len), &msg, |b, msg| {
+            b.iter(|| secp.verify_schnorr_tagged(&sig, &tag, msg, &pk))
+        });
+    }
+    group.finish();
+}
+
+criterion_group!(benches, sign, verify, tagged);
+criterion_main!(benches);
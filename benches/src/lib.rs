@@ -0,0 +1,83 @@
+// Bitcoin secp256k1 bindings
+// Written in 2023 by
+//   The rust-secp256k1 developers
+//
+// To the extent possible under law, the author(s) have dedicated all
+// copyright and related and neighboring rights to this software to
+// the public domain worldwide. This software is distributed without
+// any warranty.
+//
+// You should have received a copy of the CC0 Public Domain Dedication
+// along with this software.
+// If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+//
+
+//! # Benchmark fixtures
+//!
+//! Deterministic inputs shared by the criterion benchmarks in `benches/`.
+//!
+//! Run the whole suite with `cargo bench` from this directory, or a single group with e.g.
+//! `cargo bench --bench ecdsa -- verify`. The features of this crate forward to `secp256k1`, so
+//! `cargo bench --features=asm` measures the assembly backend.
+//!
+//! Criterion writes the estimates of every benchmark as JSON to
+//! `target/criterion/<group>/<function>/<size>/new/estimates.json`. To track regressions across an
+//! upgrade, run `cargo bench -- --save-baseline before` on the old version and
+//! `cargo bench -- --baseline before` on the new one.
+
+// Coding conventions
+#![deny(non_upper_case_globals)]
+#![deny(non_camel_case_types)]
+#![deny(non_snake_case)]
+#![deny(unused_mut)]
+#![warn(missing_docs)]
+
+use secp256k1::{KeyPair, Message, PublicKey, Secp256k1, SecretKey, Signing};
+
+/// Input sizes of the benchmarks of batch operations.
+pub const BATCH_SIZES: [usize; 4] = [1, 16, 64, 256];
+
+/// Returns 32 pseudorandom bytes determined by `seed` (using SplitMix64).
+///
+/// The benchmarks avoid `rand` so that their inputs are identical between runs and versions.
+pub fn bytes32(seed: u64) -> [u8; 32] {
+    let mut state = seed.wrapping_mul(0x9e37_79b9_7f4a_7c15);
+    let mut out = [0u8; 32];
+    for chunk in out.chunks_exact_mut(8) {
+        state = state.wrapping_add(0x9e37_79b9_7f4a_7c15);
+        let mut z = state;
+        z = (z ^ (z >> 30)).wrapping_mul(0xbf58_476d_1ce4_e5b9);
+        z = (z ^ (z >> 27)).wrapping_mul(0x94d0_49bb_1331_11eb);
+        chunk.copy_from_slice(&(z ^ (z >> 31)).to_be_bytes());
+    }
+    out
+}
+
+/// Returns `n` distinct secret keys.
+pub fn secret_keys(n: usize) -> Vec<SecretKey> {
+    let mut sks = Vec::with_capacity(n);
+    let mut seed = 0;
+    while sks.len() < n {
+        // Out of range values are astronomically unlikely, but skip them anyway.
+        if let Ok(sk) = SecretKey::from_slice(&bytes32(seed)) {
+            sks.push(sk);
+        }
+        seed += 1;
+    }
+    sks
+}
+
+/// Returns `n` distinct messages, different from the secret keys.
+pub fn messages(n: usize) -> Vec<Message> {
+    (0..n as u64).map(|i| Message::from_slice(&bytes32(!i)).unwrap()).collect()
+}
+
+/// Returns the public keys of [`secret_keys`]`(n)`.
+pub fn public_keys<C: Signing>(secp: &Secp256k1<C>, n: usize) -> Vec<PublicKey> {
+    secret_keys(n).iter().map(|sk| sk.public_key(secp)).collect()
+}
+
+/// Returns the key pairs of [`secret_keys`]`(n)`.
+pub fn keypairs<C: Signing>(secp: &Secp256k1<C>, n: usize) -> Vec<KeyPair> {
+    secret_keys(n).iter().map(|sk| sk.keypair(secp)).collect()
+}
@@ -2,7 +2,7 @@
 
 set -ex
 
-FEATURES="bitcoin-hashes global-context lowmemory rand recovery serde std alloc bitcoin-hashes-std rand-std"
+FEATURES="bitcoin-hashes global-context lowmemory rand recovery serde std alloc bitcoin-hashes-std rand-std asm sha-ni avx2"
 
 cargo --version
 rustc --version
@@ -46,6 +46,9 @@ if [ "$DO_FEATURE_MATRIX" = true ]; then
     RUSTFLAGS='--cfg=fuzzing' RUSTDOCFLAGS='--cfg=fuzzing' cargo test --all
     RUSTFLAGS='--cfg=fuzzing' RUSTDOCFLAGS='--cfg=fuzzing' cargo test --all --features="$FEATURES"
     cargo test --all --features="rand serde"
+    # Upstream's C tests, also with the SHA-256 and field kernels selected at runtime.
+    cargo test --manifest-path=secp256k1-sys/Cargo.toml --features=recovery,c-tests --test c
+    cargo test --manifest-path=secp256k1-sys/Cargo.toml --features=recovery,c-tests,sha-ni,avx2 --test c
 
     if [ "$NIGHTLY" = true ]; then
         cargo test --all --all-features
@@ -104,6 +107,22 @@ fi
 if [ "$DO_BENCH" = true ]
 then
     RUSTFLAGS='--cfg=bench' cargo bench --features=recovery,rand-std
+    # Verification speed for each selectable window size of the precomputed table.
+    for window in 8 15 20 22
+    do
+        RUSTFLAGS='--cfg=bench' cargo bench --features="recovery,rand-std,ecmult-window-$window" verify
+    done
+    # Signing and key generation (`generate`) speed with the larger table of multiples of G.
+    RUSTFLAGS='--cfg=bench' cargo bench --features=recovery,rand-std,ecmult-gen-prec-bits-8
+    # The x86_64 assembly backend, to be compared against the first run.
+    RUSTFLAGS='--cfg=bench' cargo bench --features=recovery,rand-std,asm
+    RUSTFLAGS='--cfg=bench' cargo bench --features=recovery,rand-std,sha-ni schnorr
+    RUSTFLAGS='--cfg=bench' cargo bench --features=recovery,rand-std,avx2 verify_schnorr_batch
+    # Upstream's C benchmarks, built with the same configuration as the library.
+    cargo bench --manifest-path=secp256k1-sys/Cargo.toml --features=recovery,c-bench
+    cargo bench --manifest-path=secp256k1-sys/Cargo.toml --features=recovery,c-bench,ecmult-window-22 -- bench_ecmult
+    # The criterion suite, which also runs on stable.
+    cargo bench --manifest-path=benches/Cargo.toml
 fi
 
 exit 0
@@ -0,0 +1,4 @@
+/* Upstream's bench, built by build.rs with the `c-bench` feature. */
+
+#include "bench_alloc.h"
+#include "../depend/secp256k1/src/bench.c"
@@ -0,0 +1,53 @@
+/* The allocating context and scratch space functions, which the vendored library leaves to the
+ * Rust side, implemented with malloc for the benchmark and test programs built with the `c-bench`
+ * and `c-tests` features. Include this before the upstream source, in exactly one translation
+ * unit. */
+
+#ifndef RUSTSECP256K1_BENCH_ALLOC_H
+#define RUSTSECP256K1_BENCH_ALLOC_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../depend/secp256k1/include/secp256k1.h"
+#include "../depend/secp256k1/include/secp256k1_preallocated.h"
+
+static void *bench_checked_malloc(size_t size) {
+    void *ret = malloc(size);
+    if (ret == NULL) {
+        fputs("bench: out of memory\n", stderr);
+        abort();
+    }
+    return ret;
+}
+
+rustsecp256k1_v0_8_1_context *rustsecp256k1_v0_8_1_context_create(unsigned int flags) {
+    void *prealloc = bench_checked_malloc(rustsecp256k1_v0_8_1_context_preallocated_size(flags));
+    return rustsecp256k1_v0_8_1_context_preallocated_create(prealloc, flags);
+}
+
+void rustsecp256k1_v0_8_1_context_destroy(rustsecp256k1_v0_8_1_context *ctx) {
+    if (ctx != NULL) {
+        /* Contexts and scratch spaces live at the start of their preallocated memory. */
+        rustsecp256k1_v0_8_1_context_preallocated_destroy(ctx);
+        free(ctx);
+    }
+}
+
+rustsecp256k1_v0_8_1_scratch_space *rustsecp256k1_v0_8_1_scratch_space_create(const rustsecp256k1_v0_8_1_context *ctx, size_t size) {
+    void *prealloc = bench_checked_malloc(rustsecp256k1_v0_8_1_scratch_space_preallocated_size(size));
+    return rustsecp256k1_v0_8_1_scratch_space_preallocated_create(ctx, prealloc, size);
+}
+
+void rustsecp256k1_v0_8_1_scratch_space_destroy(const rustsecp256k1_v0_8_1_context *ctx, rustsecp256k1_v0_8_1_scratch_space *scratch) {
+    /* A scratch space starts with its magic. One without it is reported to the error callback by
+     * the preallocated destroy, and left alone like upstream does. */
+    int valid = scratch != NULL && memcmp(scratch, "scratch", 8) == 0;
+    rustsecp256k1_v0_8_1_scratch_space_preallocated_destroy(ctx, scratch);
+    if (valid) {
+        free(scratch);
+    }
+}
+
+#endif /* RUSTSECP256K1_BENCH_ALLOC_H */
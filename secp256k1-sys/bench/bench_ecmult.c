@@ -0,0 +1,7 @@
+/* Upstream's bench_ecmult, built by build.rs with the `c-bench` feature. It includes secp256k1.c, so
+ * the library headers are processed as part of the library build. */
+
+#define SECP256K1_BUILD
+
+#include "bench_alloc.h"
+#include "../depend/secp256k1/src/bench_ecmult.c"
@@ -0,0 +1,49 @@
+/* Upstream's tests, built by build.rs with the `c-tests` feature. It includes secp256k1.c, so the
+ * library headers are processed as part of the library build. Besides the allocating functions of
+ * bench_alloc.h, the tests use the internal allocating helpers the vendored library removes, which
+ * are restored below as upstream has them. */
+
+#define SECP256K1_BUILD
+
+#include "bench_alloc.h"
+#include "../depend/secp256k1/src/util.h"
+
+static SECP256K1_INLINE void *checked_malloc(const rustsecp256k1_v0_8_1_callback* cb, size_t size) {
+    void *ret = malloc(size);
+    if (ret == NULL) {
+        rustsecp256k1_v0_8_1_callback_call(cb, "Out of memory");
+    }
+    return ret;
+}
+
+rustsecp256k1_v0_8_1_context *rustsecp256k1_v0_8_1_context_clone(const rustsecp256k1_v0_8_1_context *ctx) {
+    void *prealloc = bench_checked_malloc(rustsecp256k1_v0_8_1_context_preallocated_clone_size(ctx));
+    return rustsecp256k1_v0_8_1_context_preallocated_clone(ctx, prealloc);
+}
+
+#include "../depend/secp256k1/src/tests.c"
+
+static rustsecp256k1_v0_8_1_scratch* rustsecp256k1_v0_8_1_scratch_create(const rustsecp256k1_v0_8_1_callback* error_callback, size_t size) {
+    const size_t base_alloc = ROUND_TO_ALIGN(sizeof(rustsecp256k1_v0_8_1_scratch));
+    void *alloc = checked_malloc(error_callback, base_alloc + size);
+    rustsecp256k1_v0_8_1_scratch* ret = (rustsecp256k1_v0_8_1_scratch *)alloc;
+    if (ret != NULL) {
+        memset(ret, 0, sizeof(*ret));
+        memcpy(ret->magic, "scratch", 8);
+        ret->data = (void *) ((char *) alloc + base_alloc);
+        ret->max_size = size;
+    }
+    return ret;
+}
+
+static void rustsecp256k1_v0_8_1_scratch_destroy(const rustsecp256k1_v0_8_1_callback* error_callback, rustsecp256k1_v0_8_1_scratch* scratch) {
+    if (scratch != NULL) {
+        if (rustsecp256k1_v0_8_1_memcmp_var(scratch->magic, "scratch", 8) != 0) {
+            rustsecp256k1_v0_8_1_callback_call(error_callback, "invalid scratch space");
+            return;
+        }
+        VERIFY_CHECK(scratch->alloc_size == 0); /* all checkpoints should be applied */
+        memset(scratch->magic, 0, sizeof(scratch->magic));
+        free(scratch);
+    }
+}
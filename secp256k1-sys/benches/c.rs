@@ -0,0 +1,44 @@
+//! Runs upstream's C benchmark programs, compiled by the build script with the same configuration
+//! as the library when the `c-bench` feature is enabled.
+//!
+//! `cargo bench --features=c-bench` runs `bench`, `bench_internal` and `bench_ecmult` in turn.
+//! Naming one of them runs only that program, passing it the remaining arguments, e.g.
+//! `cargo bench --features=c-bench -- bench_internal field`. `SECP256K1_BENCH_ITERS` sets the
+//! number of iterations.
+//!
+//! Each program prints a table of `Benchmark, Min(us), Avg(us), Max(us)` rows, preceded here by
+//! the defines it was compiled with, so that the output of different feature selections (e.g.
+//! `ecmult-window-*` or `asm`) can be compared line by line.
+
+use std::env;
+use std::process::{self, Command};
+
+const PROGRAMS: [(&str, &str); 3] = [
+    ("bench", env!("SECP256K1_BENCH_BENCH")),
+    ("bench_internal", env!("SECP256K1_BENCH_BENCH_INTERNAL")),
+    ("bench_ecmult", env!("SECP256K1_BENCH_BENCH_ECMULT")),
+];
+
+fn run(name: &str, path: &str, args: &[String]) {
+    println!("# {} ({})", name, env!("SECP256K1_BENCH_CONFIG"));
+    let status = Command::new(path).args(args).status().unwrap_or_else(|e| {
+        eprintln!("failed to run {}: {}", path, e);
+        process::exit(1);
+    });
+    if !status.success() {
+        process::exit(status.code().unwrap_or(1));
+    }
+}
+
+fn main() {
+    // Cargo passes `--bench` to benchmarks without the libtest harness.
+    let args: Vec<String> = env::args().skip(1).filter(|arg| arg != "--bench").collect();
+    match PROGRAMS.iter().find(|&&(name, _)| Some(name) == args.first().map(String::as_str)) {
+        Some(&(name, path)) => run(name, path, &args[1..]),
+        None if args.is_empty() => PROGRAMS.iter().for_each(|&(name, path)| run(name, path, &[])),
+        None => {
+            eprintln!("unknown benchmark program {}, expected one of bench, bench_internal or bench_ecmult", args[0]);
+            process::exit(1);
+        }
+    }
+}
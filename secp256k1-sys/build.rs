@@ -24,6 +24,118 @@
 extern crate cc;
 
 use std::env;
+use std::fs;
+use std::path::{Path, PathBuf};
+use std::process::Command;
+
+/// Returns the window size of the precomputed table of multiples of G selected by the
+/// `ecmult-window-*` features (the largest one if several are enabled), if any.
+fn ecmult_window_feature() -> Option<u32> {
+    if cfg!(feature = "ecmult-window-22") {
+        Some(22)
+    } else if cfg!(feature = "ecmult-window-20") {
+        Some(20)
+    } else if cfg!(feature = "ecmult-window-15") {
+        Some(15)
+    } else if cfg!(feature = "ecmult-window-8") {
+        Some(8)
+    } else {
+        None
+    }
+}
+
+/// Generates `precomputed_ecmult.c` for window sizes beyond the 15 covered by the vendored
+/// table, by compiling and running upstream's `precompute_ecmult` on the host.
+fn generate_ecmult_table(window: u32) -> PathBuf {
+    let out_dir = PathBuf::from(env::var("OUT_DIR").unwrap());
+    let host = env::var("HOST").unwrap();
+    let exe = out_dir.join(if host.contains("windows") { "precompute_ecmult.exe" } else { "precompute_ecmult" });
+
+    let compiler = cc::Build::new().target(&host).host(&host).opt_level(2).cargo_metadata(false).get_compiler();
+    let mut cmd = compiler.to_command();
+    cmd.arg("-Idepend/secp256k1/src")
+       .arg(format!("-DECMULT_WINDOW_SIZE={}", window))
+       .arg("depend/secp256k1/src/precompute_ecmult.c");
+    if compiler.is_like_msvc() {
+        cmd.arg(format!("/Fe{}", exe.display()));
+    } else {
+        cmd.arg("-o").arg(&exe);
+    }
+    let status = cmd.status().expect("failed to run the host C compiler");
+    assert!(status.success(), "failed to compile precompute_ecmult");
+
+    // precompute_ecmult writes src/precomputed_ecmult.c relative to its working directory.
+    fs::create_dir_all(out_dir.join("src")).unwrap();
+    let status = Command::new(&exe).current_dir(&out_dir).status().expect("failed to run precompute_ecmult");
+    assert!(status.success(), "precompute_ecmult failed");
+    out_dir.join("src/precomputed_ecmult.c")
+}
+
+/// Compiles upstream's benchmark programs with the compiler flags and defines of `config`, linking
+/// in `ecmult_table`, and passes their location and configuration to the `c` bench target.
+fn compile_c_benches(config: &cc::Build, ecmult_table: &Path) {
+    let out_dir = PathBuf::from(env::var("OUT_DIR").unwrap());
+    let windows = env::var("CARGO_CFG_TARGET_OS").unwrap() == "windows";
+    let compiler = config.get_compiler();
+
+    // The defines identify the configuration in the output, so that runs can be compared.
+    let defines: Vec<&str> = compiler.args().iter()
+        .filter_map(|arg| arg.to_str())
+        .filter(|arg| arg.starts_with("-D") || arg.starts_with("/D"))
+        .map(|arg| &arg[2..])
+        .collect();
+    println!("cargo:rustc-env=SECP256K1_BENCH_CONFIG={}", defines.join(" "));
+
+    // bench links against the library, while bench_internal and bench_ecmult include secp256k1.c.
+    let programs: [(&str, &[&str]); 3] = [
+        ("bench", &["bench/bench.c", "depend/secp256k1/src/secp256k1.c"]),
+        ("bench_internal", &["bench/bench_internal.c"]),
+        ("bench_ecmult", &["bench/bench_ecmult.c"]),
+    ];
+    for &(name, sources) in programs.iter() {
+        let exe = out_dir.join(if windows { format!("{}.exe", name) } else { name.to_string() });
+        let mut cmd = compiler.to_command();
+        cmd.args(sources)
+           .arg(ecmult_table)
+           .arg("depend/secp256k1/src/precomputed_ecmult_gen.c");
+        if compiler.is_like_msvc() {
+            cmd.arg(format!("/Fo{}\\", out_dir.display()))
+               .arg(format!("/Fe{}", exe.display()));
+        } else {
+            cmd.arg("-o").arg(&exe);
+        }
+        let status = cmd.status().expect("failed to run the C compiler");
+        assert!(status.success(), "failed to compile {}", name);
+        println!("cargo:rustc-env=SECP256K1_BENCH_{}={}", name.to_uppercase(), exe.display());
+    }
+}
+
+/// Compiles upstream's test program with the compiler flags and defines of `config` and `VERIFY`,
+/// linking in `ecmult_table`, and passes its location to the `c` test target.
+fn compile_c_tests(config: &cc::Build, ecmult_table: &Path) {
+    let out_dir = PathBuf::from(env::var("OUT_DIR").unwrap());
+    let windows = env::var("CARGO_CFG_TARGET_OS").unwrap() == "windows";
+    // Upstream's scratch space test destroys one on the stack, which bench_alloc.h does not free.
+    let compiler = config.clone()
+        .define("VERIFY", None)
+        .flag_if_supported("-Wno-free-nonheap-object")
+        .get_compiler();
+
+    let exe = out_dir.join(if windows { "tests.exe" } else { "tests" });
+    let mut cmd = compiler.to_command();
+    cmd.arg("bench/tests.c")
+       .arg(ecmult_table)
+       .arg("depend/secp256k1/src/precomputed_ecmult_gen.c");
+    if compiler.is_like_msvc() {
+        cmd.arg(format!("/Fo{}\\", out_dir.display()))
+           .arg(format!("/Fe{}", exe.display()));
+    } else {
+        cmd.arg("-o").arg(&exe);
+    }
+    let status = cmd.status().expect("failed to run the C compiler");
+    assert!(status.success(), "failed to compile tests");
+    println!("cargo:rustc-env=SECP256K1_TESTS={}", exe.display());
+}
 
 fn main() {
     // Actual build
@@ -37,14 +149,41 @@ fn main() {
                .define("ENABLE_MODULE_SCHNORRSIG", Some("1"))
                .define("ENABLE_MODULE_EXTRAKEYS", Some("1"));
 
-    if cfg!(feature = "lowmemory") {
-        base_config.define("ECMULT_WINDOW_SIZE", Some("4")); // A low-enough value to consume negligible memory
-        base_config.define("ECMULT_GEN_PREC_BITS", Some("2"));
+    // An explicitly selected table size, else a small one with lowmemory.
+    let gen_prec_bits = if cfg!(feature = "ecmult-gen-prec-bits-8") {
+        "8"
+    } else if cfg!(feature = "lowmemory") {
+        "2"
     } else {
-        base_config.define("ECMULT_GEN_PREC_BITS", Some("4"));
-        base_config.define("ECMULT_WINDOW_SIZE", Some("15")); // This is the default in the configure file (`auto`)
+        "4"
+    };
+    base_config.define("ECMULT_GEN_PREC_BITS", Some(gen_prec_bits));
+    // An explicitly selected window, else a low-enough value to consume negligible memory with
+    // lowmemory, else the default in the configure file (`auto`).
+    let ecmult_window = ecmult_window_feature();
+    let window = ecmult_window.unwrap_or(if cfg!(feature = "lowmemory") { 4 } else { 15 });
+    base_config.define("ECMULT_WINDOW_SIZE", Some(window.to_string().as_str()));
+    // The x86_64 field and scalar assembly is GCC style inline assembly, which MSVC does not support.
+    if cfg!(feature = "asm")
+        && env::var("CARGO_CFG_TARGET_ARCH").unwrap() == "x86_64"
+        && env::var("CARGO_CFG_TARGET_ENV").unwrap() != "msvc"
+    {
+        base_config.define("USE_ASM_X86_64", Some("1"));
+    }
+    // SHA-256 transform using the SHA extensions, selected at runtime if the CPU supports them.
+    if cfg!(feature = "sha-ni")
+        && env::var("CARGO_CFG_TARGET_ARCH").unwrap() == "x86_64"
+        && env::var("CARGO_CFG_TARGET_ENV").unwrap() != "msvc"
+    {
+        base_config.define("USE_SHA_NI_DISPATCH", Some("1"));
+    }
+    // Eight-lane SHA-256 transform using AVX2, selected at runtime if the CPU supports it.
+    if cfg!(feature = "avx2")
+        && env::var("CARGO_CFG_TARGET_ARCH").unwrap() == "x86_64"
+        && env::var("CARGO_CFG_TARGET_ENV").unwrap() != "msvc"
+    {
+        base_config.define("USE_AVX2_DISPATCH", Some("1"));
     }
-    base_config.define("USE_EXTERNAL_DEFAULT_CALLBACKS", Some("1"));
     #[cfg(feature = "recovery")]
     base_config.define("ENABLE_MODULE_RECOVERY", Some("1"));
 
@@ -54,11 +193,25 @@ fn main() {
                    .file("wasm/wasm.c");
     }
 
+    let ecmult_table = match ecmult_window {
+        Some(window) if window > 15 => generate_ecmult_table(window),
+        _ => PathBuf::from("depend/secp256k1/src/precomputed_ecmult.c"),
+    };
+
+    // The benchmark and test programs use the default callbacks of the C library rather than ours.
+    if cfg!(feature = "c-bench") {
+        compile_c_benches(&base_config, &ecmult_table);
+    }
+    if cfg!(feature = "c-tests") {
+        compile_c_tests(&base_config, &ecmult_table);
+    }
+    base_config.define("USE_EXTERNAL_DEFAULT_CALLBACKS", Some("1"));
+
     // secp256k1
     base_config.file("depend/secp256k1/contrib/lax_der_parsing.c")
                .file("depend/secp256k1/src/precomputed_ecmult_gen.c")
-               .file("depend/secp256k1/src/precomputed_ecmult.c")
-               .file("depend/secp256k1/src/secp256k1.c");
+               .file("depend/secp256k1/src/secp256k1.c")
+               .file(ecmult_table);
 
     if base_config.try_compile("libsecp256k1.a").is_err() {
         // Some embedded platforms may not have, eg, string.h available, so if the build fails
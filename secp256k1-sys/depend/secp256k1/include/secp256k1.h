@@ -75,6 +75,18 @@ typedef struct {
     unsigned char data[64];
 } rustsecp256k1_v0_8_1_pubkey;
 
+/** Opaque data structure that holds a public key together with a table of its
+ *  precomputed multiples, to speed up repeated verification against that key.
+ *
+ *  The exact representation of data inside is implementation defined and not
+ *  guaranteed to be portable between different platforms or versions. It is
+ *  however guaranteed to be 4096 bytes in size, and can be safely copied/moved.
+ *  Create it with rustsecp256k1_v0_8_1_ec_pubkey_prepare.
+ */
+typedef struct {
+    unsigned char data[4096];
+} rustsecp256k1_v0_8_1_prepared_pubkey;
+
 /** Opaque data structured that holds a parsed ECDSA signature.
  *
  *  The exact representation of data inside is implementation defined and not
@@ -88,6 +100,20 @@ typedef struct {
     unsigned char data[64];
 } rustsecp256k1_v0_8_1_ecdsa_signature;
 
+/** Opaque data structure that holds the nonce dependent part of an ECDSA
+ *  signature: the inverse of the nonce and the r value of the signature.
+ *
+ *  The exact representation of data inside is implementation defined and not
+ *  guaranteed to be portable between different platforms or versions. It is
+ *  however guaranteed to be 64 bytes in size. It is secret, and creating two
+ *  signatures with the same presignature reveals the secret key, so it must not
+ *  be copied. Create it with rustsecp256k1_v0_8_1_ecdsa_presignature_create, use it
+ *  with rustsecp256k1_v0_8_1_ecdsa_sign_with_presignature (which zeroes it).
+ */
+typedef struct {
+    unsigned char data[64];
+} rustsecp256k1_v0_8_1_ecdsa_presignature;
+
 /** A pointer to a function to deterministically generate a nonce.
  *
  * Returns: 1 if a nonce was successfully generated. 0 will cause signing to fail.
@@ -413,6 +439,28 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int rustsecp256k1_v0_8_1_ec_pubkey_pa
     size_t inputlen
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3);
 
+/** Parse a batch of public keys of the same length.
+ *
+ *  Equivalent to calling rustsecp256k1_v0_8_1_ec_pubkey_parse on every input, but when built
+ *  with USE_AVX2_DISPATCH and running on a CPU supporting AVX2, compressed keys are
+ *  decompressed four at a time, taking their square roots in the lanes of AVX2 registers.
+ *
+ *  Returns: 1: all public keys were valid, all parsed.
+ *           0: at least one public key could not be parsed or was invalid, it is zeroed.
+ *  Args:    ctx:      a secp256k1 context object.
+ *  Out:     pubkeys:  array of n pubkey objects.
+ *  In:      inputs:   array of pointers to n serialized public keys.
+ *           inputlen: length of every serialized public key.
+ *           n:        number of keys.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int rustsecp256k1_v0_8_1_ec_pubkey_parse_batch(
+    const rustsecp256k1_v0_8_1_context* ctx,
+    rustsecp256k1_v0_8_1_pubkey *pubkeys,
+    const unsigned char *const *inputs,
+    size_t inputlen,
+    size_t n
+) SECP256K1_ARG_NONNULL(1);
+
 /** Serialize a pubkey object into a serialized byte sequence.
  *
  *  Returns: 1 always.
@@ -559,6 +607,64 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int rustsecp256k1_v0_8_1_ecdsa_verify
     const rustsecp256k1_v0_8_1_pubkey *pubkey
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4);
 
+/** Compute the table of precomputed multiples of a public key.
+ *
+ *  Returns: 1 always.
+ *  Args:    ctx:      a secp256k1 context object.
+ *  Out:     prepared: pointer to the prepared public key to fill.
+ *  In:      pubkey:   pointer to an initialized public key.
+ */
+SECP256K1_API int rustsecp256k1_v0_8_1_ec_pubkey_prepare(
+    const rustsecp256k1_v0_8_1_context* ctx,
+    rustsecp256k1_v0_8_1_prepared_pubkey *prepared,
+    const rustsecp256k1_v0_8_1_pubkey *pubkey
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3);
+
+/** Verify an ECDSA signature against a prepared public key.
+ *
+ *  Same as rustsecp256k1_v0_8_1_ecdsa_verify, but faster as the multiples of the
+ *  public key do not need to be recomputed.
+ *
+ *  Returns: 1: correct signature
+ *           0: incorrect or unparseable signature
+ *  Args:    ctx:       a secp256k1 context object.
+ *  In:      sig:       the signature being verified.
+ *           msghash32: the 32-byte message hash being verified.
+ *           prepared:  pointer to the prepared public key to verify with.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int rustsecp256k1_v0_8_1_ecdsa_verify_prepared(
+    const rustsecp256k1_v0_8_1_context* ctx,
+    const rustsecp256k1_v0_8_1_ecdsa_signature *sig,
+    const unsigned char *msghash32,
+    const rustsecp256k1_v0_8_1_prepared_pubkey *prepared
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4);
+
+/** Verify a batch of ECDSA signatures.
+ *
+ *  Equivalent to calling rustsecp256k1_v0_8_1_ecdsa_verify on every signature of the
+ *  batch, but the scalar inversions of the signatures are shared.
+ *
+ *  Returns: 1: all signatures are correct
+ *           0: at least one signature is incorrect or unparseable
+ *  Args:    ctx:          a secp256k1 context object.
+ *  Out:     failed_index: if not NULL and 0 is returned, set to the index of the
+ *                         first incorrect signature.
+ *  In:      sigs:         array of pointers to the signatures being verified.
+ *           msghash32:    array of pointers to the 32-byte message hashes.
+ *           pubkeys:      array of pointers to the public keys to verify with.
+ *           n_sigs:       number of signatures in the batch.
+ *
+ *  As with rustsecp256k1_v0_8_1_ecdsa_verify, only signatures in lower-S form are accepted.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int rustsecp256k1_v0_8_1_ecdsa_verify_batch(
+    const rustsecp256k1_v0_8_1_context* ctx,
+    size_t *failed_index,
+    const rustsecp256k1_v0_8_1_ecdsa_signature *const *sigs,
+    const unsigned char *const *msghash32,
+    const rustsecp256k1_v0_8_1_pubkey *const *pubkeys,
+    size_t n_sigs
+) SECP256K1_ARG_NONNULL(1);
+
 /** Convert a signature to a normalized lower-S form.
  *
  *  Returns: 1 if sigin was not normalized, 0 if it already was.
@@ -642,6 +748,112 @@ SECP256K1_API int rustsecp256k1_v0_8_1_ecdsa_sign(
     const void *ndata
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4);
 
+/** A pointer to a function deciding whether rustsecp256k1_v0_8_1_ecdsa_sign_grind accepts a
+ *  signature.
+ *
+ *  Returns: 1 to accept the signature, 0 to try the next one.
+ *  In:      sig:  pointer to the candidate signature (will not be NULL)
+ *           data: arbitrary data pointer that is passed through.
+ */
+typedef int (*rustsecp256k1_v0_8_1_ecdsa_grind_function)(
+    const rustsecp256k1_v0_8_1_ecdsa_signature *sig,
+    void *data
+);
+
+/** Create an ECDSA signature, grinding the nonce until check accepts the signature.
+ *
+ *  The first attempt is the signature of rustsecp256k1_v0_8_1_ecdsa_sign with
+ *  rustsecp256k1_v0_8_1_nonce_function_rfc6979 and no extra data. Attempt i > 0
+ *  passes 32 bytes of extra data holding i as a little endian 32-bit integer
+ *  followed by zeros, the scheme Bitcoin Core uses to grind for low R values.
+ *  The part of the RFC6979 state derived from the secret key and message is
+ *  computed once for all attempts. Loops until check returns 1.
+ *
+ *  Returns: 1: signature created
+ *           0: the secret key was invalid.
+ *  Args:    ctx:       pointer to a context object (not rustsecp256k1_v0_8_1_context_static).
+ *  Out:     sig:       pointer to an array where the accepted signature will be placed.
+ *  In:      msghash32: the 32-byte message hash being signed.
+ *           seckey:    pointer to a 32-byte secret key.
+ *           check:     pointer to a function accepting or rejecting each signature.
+ *           data:      arbitrary data pointer passed to check (can be NULL).
+ */
+SECP256K1_API int rustsecp256k1_v0_8_1_ecdsa_sign_grind(
+    const rustsecp256k1_v0_8_1_context* ctx,
+    rustsecp256k1_v0_8_1_ecdsa_signature *sig,
+    const unsigned char *msghash32,
+    const unsigned char *seckey,
+    rustsecp256k1_v0_8_1_ecdsa_grind_function check,
+    void *data
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4) SECP256K1_ARG_NONNULL(5);
+
+/** Create a batch of ECDSA signatures.
+ *
+ *  Each signature is identical to the one rustsecp256k1_v0_8_1_ecdsa_sign creates with the
+ *  default nonce function and no extra data, but the inversions of the nonces and the
+ *  conversions of the nonce points to affine coordinates are shared by the batch.
+ *
+ *  Returns: 1: all signatures created
+ *           0: some secret key was invalid. The signature of an invalid secret key is
+ *              zeroed, all others are created.
+ *  Args:    ctx:        pointer to a context object (not rustsecp256k1_v0_8_1_context_static).
+ *  Out:     signatures: pointer to an array of n signatures.
+ *  In:      msghash32:  pointer to an array of n pointers to 32-byte message hashes.
+ *           seckeys:    pointer to an array of n pointers to 32-byte secret keys.
+ *           n:          the number of signatures to create.
+ */
+SECP256K1_API int rustsecp256k1_v0_8_1_ecdsa_sign_batch(
+    const rustsecp256k1_v0_8_1_context* ctx,
+    rustsecp256k1_v0_8_1_ecdsa_signature *signatures,
+    const unsigned char *const *msghash32,
+    const unsigned char *const *seckeys,
+    size_t n
+) SECP256K1_ARG_NONNULL(1);
+
+/** Precompute the nonce dependent part of an ECDSA signature.
+ *
+ *  This performs the multiplication of the generator and the inversion of the
+ *  nonce, which dominate the cost of signing, ahead of knowing the message and
+ *  the secret key. The nonce must be uniformly random and never used again;
+ *  unlike rustsecp256k1_v0_8_1_ecdsa_sign, signatures created from a presignature
+ *  are not deterministic.
+ *
+ *  Returns: 1: presignature created
+ *           0: the nonce was invalid (zero or not less than the group order), or
+ *              produced an r value of zero. The presignature is zeroed.
+ *  Args:    ctx:     pointer to a context object (not rustsecp256k1_v0_8_1_context_static).
+ *  Out:     presig:  pointer to a presignature object.
+ *  In:      nonce32: pointer to a 32-byte uniformly random nonce.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int rustsecp256k1_v0_8_1_ecdsa_presignature_create(
+    const rustsecp256k1_v0_8_1_context* ctx,
+    rustsecp256k1_v0_8_1_ecdsa_presignature *presig,
+    const unsigned char *nonce32
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3);
+
+/** Create an ECDSA signature from a presignature.
+ *
+ *  Completes the signature with two scalar multiplications and an addition. The
+ *  created signature is always in lower-S form. The presignature is zeroed, so
+ *  that using it a second time fails instead of revealing the secret key.
+ *
+ *  Returns: 1: signature created
+ *           0: the secret key or the presignature was invalid (including a presignature
+ *              that was used before). The signature is zeroed.
+ *  Args:    ctx:       pointer to a context object.
+ *  Out:     signature: pointer to an array where the signature will be placed.
+ *  In:      msghash32: the 32-byte message hash being signed.
+ *           seckey:    pointer to a 32-byte secret key.
+ *  In/Out:  presig:    pointer to a presignature, zeroed on return.
+ */
+SECP256K1_API int rustsecp256k1_v0_8_1_ecdsa_sign_with_presignature(
+    const rustsecp256k1_v0_8_1_context* ctx,
+    rustsecp256k1_v0_8_1_ecdsa_signature *signature,
+    const unsigned char *msghash32,
+    const unsigned char *seckey,
+    rustsecp256k1_v0_8_1_ecdsa_presignature *presig
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4) SECP256K1_ARG_NONNULL(5);
+
 /** Verify an ECDSA secret key.
  *
  *  A secret key is valid if it is not 0 and less than the secp256k1 curve order
@@ -659,6 +871,25 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int rustsecp256k1_v0_8_1_ec_seckey_ve
     const unsigned char *seckey
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2);
 
+/** Compute the public keys for a batch of secret keys.
+ *
+ *  Equivalent to calling rustsecp256k1_v0_8_1_ec_pubkey_create on every secret key, but
+ *  the conversions of the public keys to affine coordinates share a field inversion.
+ *
+ *  Returns: 1: all secret keys were valid, all public keys stored.
+ *           0: at least one secret key was invalid, its public key is zeroed.
+ *  Args:    ctx:     pointer to a context object (not rustsecp256k1_v0_8_1_context_static).
+ *  Out:     pubkeys: array of n public keys.
+ *  In:      seckeys: array of pointers to n 32-byte secret keys.
+ *           n:       number of keys.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int rustsecp256k1_v0_8_1_ec_pubkey_create_batch(
+    const rustsecp256k1_v0_8_1_context* ctx,
+    rustsecp256k1_v0_8_1_pubkey *pubkeys,
+    const unsigned char *const *seckeys,
+    size_t n
+) SECP256K1_ARG_NONNULL(1);
+
 /** Compute the public key for a secret key.
  *
  *  Returns: 1: secret was valid, public key stores.
@@ -858,6 +1089,31 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int rustsecp256k1_v0_8_1_ec_pubkey_co
     size_t n
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3);
 
+/** Compute a range of public keys with a common difference.
+ *
+ *  Sets pubkeys[i] to next + i*step for every i < n and then next to next + n*step,
+ *  using one point addition per public key and converting chunks of public keys to
+ *  affine coordinates with a single field inversion. This does not run in constant
+ *  time.
+ *
+ *  Returns: 1: all public keys are valid.
+ *           0: the range reaches the point at infinity. pubkeys is zeroed and next
+ *              is left unchanged.
+ *  Args:    ctx:     pointer to a context object.
+ *  Out:     pubkeys: array of n public keys.
+ *  In/Out:  next:    pointer to the first public key of the range, set to the public
+ *                    key following the range.
+ *  In:      step:    pointer to the difference between consecutive public keys.
+ *           n:       the number of public keys to compute.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int rustsecp256k1_v0_8_1_ec_pubkey_range(
+    const rustsecp256k1_v0_8_1_context* ctx,
+    rustsecp256k1_v0_8_1_pubkey *pubkeys,
+    rustsecp256k1_v0_8_1_pubkey *next,
+    const rustsecp256k1_v0_8_1_pubkey *step,
+    size_t n
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4);
+
 /** Compute a tagged hash as defined in BIP-340.
  *
  *  This is useful for creating a message hash and achieving domain separation
@@ -883,6 +1139,45 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int rustsecp256k1_v0_8_1_tagged_sha25
     size_t msglen
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(5);
 
+/** Compute the SHA256 state of a tagged hash after hashing SHA256(tag)||SHA256(tag).
+ *
+ *  The midstate only depends on the tag, so it can be computed once and passed
+ *  to rustsecp256k1_v0_8_1_tagged_sha256_from_midstate for every message, saving the
+ *  two compressions of hashing the tag itself.
+ *
+ *  Returns: 1 always.
+ *  Args:        ctx: pointer to a context object
+ *  Out:  midstate32: pointer to a 32-byte array to store the state words (big endian)
+ *  In:          tag: pointer to an array containing the tag
+ *            taglen: length of the tag array
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int rustsecp256k1_v0_8_1_tagged_sha256_midstate(
+    const rustsecp256k1_v0_8_1_context* ctx,
+    unsigned char *midstate32,
+    const unsigned char *tag,
+    size_t taglen
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3);
+
+/** Compute a tagged hash from the midstate of its tag.
+ *
+ *  Returns the same hash as rustsecp256k1_v0_8_1_tagged_sha256 for the tag whose
+ *  midstate was computed by rustsecp256k1_v0_8_1_tagged_sha256_midstate.
+ *
+ *  Returns: 1 always.
+ *  Args:        ctx: pointer to a context object
+ *  Out:      hash32: pointer to a 32-byte array to store the resulting hash
+ *  In:   midstate32: pointer to the 32-byte midstate of the tag
+ *               msg: pointer to an array containing the message
+ *            msglen: length of the message array
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int rustsecp256k1_v0_8_1_tagged_sha256_from_midstate(
+    const rustsecp256k1_v0_8_1_context* ctx,
+    unsigned char *hash32,
+    const unsigned char *midstate32,
+    const unsigned char *msg,
+    size_t msglen
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4);
+
 #ifdef __cplusplus
 }
 #endif
@@ -56,6 +56,38 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int rustsecp256k1_v0_8_1_ecdh(
   void *data
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4);
 
+/** Compute EC Diffie-Hellman secrets of one scalar with many points in constant time
+ *
+ *  Equivalent to calling rustsecp256k1_v0_8_1_ecdh for every point, but the scalar is only
+ *  decoded once and the shared points are converted to affine coordinates with a single
+ *  field inversion per 64 points.
+ *
+ *  Returns: 1: exponentiation was successful for all points
+ *           0: scalar was invalid (zero or overflow) or hashfp returned 0 for some point
+ *  Args:    ctx:        pointer to a context object.
+ *  Out:     output:     pointer to an array of n_points * outputlen bytes. The output of hashfp
+ *                       for the i-th point is written to output + i * outputlen.
+ *  In:      outputlen:  number of bytes written by hashfp (32 for
+ *                       rustsecp256k1_v0_8_1_ecdh_hash_function_sha256).
+ *           pubkeys:    pointer to an array of n_points initialized public keys.
+ *           n_points:   number of public keys.
+ *           seckey:     a 32-byte scalar with which to multiply the points.
+ *           hashfp:     pointer to a hash function, called once per point in order. If NULL,
+ *                       rustsecp256k1_v0_8_1_ecdh_hash_function_sha256 is used.
+ *           data:       arbitrary data pointer that is passed through to hashfp
+ *                       (can be NULL for rustsecp256k1_v0_8_1_ecdh_hash_function_sha256).
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int rustsecp256k1_v0_8_1_ecdh_many(
+  const rustsecp256k1_v0_8_1_context* ctx,
+  unsigned char *output,
+  size_t outputlen,
+  const rustsecp256k1_v0_8_1_pubkey *pubkeys,
+  size_t n_points,
+  const unsigned char *seckey,
+  rustsecp256k1_v0_8_1_ecdh_hash_function hashfp,
+  void *data
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(6);
+
 #ifdef __cplusplus
 }
 #endif
@@ -123,6 +123,78 @@ SECP256K1_API void rustsecp256k1_v0_8_1_context_preallocated_destroy(
     rustsecp256k1_v0_8_1_context* ctx
 ) SECP256K1_ARG_NONNULL(1);
 
+/** Determine the memory size of a secp256k1 scratch space object to be created
+ *  in caller-provided memory.
+ *
+ *  Returns: the required size of the caller-provided memory block.
+ *  In:      size: amount of memory to be available as scratch space.
+ */
+SECP256K1_API size_t rustsecp256k1_v0_8_1_scratch_space_preallocated_size(
+    size_t size
+) SECP256K1_WARN_UNUSED_RESULT;
+
+/** Create a secp256k1 scratch space object in caller-provided memory.
+ *
+ *  The caller must provide a pointer to a rewritable contiguous block of memory
+ *  of size at least rustsecp256k1_v0_8_1_scratch_space_preallocated_size(size) bytes,
+ *  suitably aligned to hold an object of any type. As with preallocated
+ *  contexts, the block is exclusively owned by the scratch space until
+ *  rustsecp256k1_v0_8_1_scratch_space_preallocated_destroy returns.
+ *
+ *  Returns: a newly created scratch space.
+ *  Args:    ctx:      an existing context object.
+ *  In:      prealloc: a pointer to a rewritable contiguous block of memory of
+ *                     size at least rustsecp256k1_v0_8_1_scratch_space_preallocated_size(size)
+ *                     bytes, as detailed above.
+ *           size:     amount of memory to be available as scratch space.
+ */
+SECP256K1_API rustsecp256k1_v0_8_1_scratch_space* rustsecp256k1_v0_8_1_scratch_space_preallocated_create(
+    const rustsecp256k1_v0_8_1_context* ctx,
+    void* prealloc,
+    size_t size
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_WARN_UNUSED_RESULT;
+
+/** Destroy a secp256k1 scratch space that has been created in caller-provided
+ *  memory.
+ *
+ *  The pointer may not be used afterwards. It is the responsibility of the
+ *  caller to deallocate the block of memory after this function returns.
+ *  Args:       ctx: a secp256k1 context object.
+ *          scratch: space to destroy
+ */
+SECP256K1_API void rustsecp256k1_v0_8_1_scratch_space_preallocated_destroy(
+    const rustsecp256k1_v0_8_1_context* ctx,
+    rustsecp256k1_v0_8_1_scratch_space* scratch
+) SECP256K1_ARG_NONNULL(1);
+
+/** Return a checkpoint of a scratch space, i.e. the amount of memory currently
+ *  allocated from it.
+ *
+ *  Returns: an opaque checkpoint to pass to rustsecp256k1_v0_8_1_scratch_space_apply_checkpoint.
+ *  Args:    ctx:     a secp256k1 context object.
+ *  In:      scratch: the scratch space to checkpoint.
+ */
+SECP256K1_API size_t rustsecp256k1_v0_8_1_scratch_space_checkpoint(
+    const rustsecp256k1_v0_8_1_context* ctx,
+    const rustsecp256k1_v0_8_1_scratch_space* scratch
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_WARN_UNUSED_RESULT;
+
+/** Undo all allocations made from a scratch space since a checkpoint was taken.
+ *
+ *  Applying the checkpoint 0 releases everything, so that the scratch space can
+ *  be reused by the next batch operation.
+ *
+ *  Args:    ctx:        a secp256k1 context object.
+ *  In/Out:  scratch:    the scratch space to roll back.
+ *  In:      checkpoint: a checkpoint returned by
+ *                       rustsecp256k1_v0_8_1_scratch_space_checkpoint for this scratch space.
+ */
+SECP256K1_API void rustsecp256k1_v0_8_1_scratch_space_apply_checkpoint(
+    const rustsecp256k1_v0_8_1_context* ctx,
+    rustsecp256k1_v0_8_1_scratch_space* scratch,
+    size_t checkpoint
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2);
+
 #ifdef __cplusplus
 }
 #endif
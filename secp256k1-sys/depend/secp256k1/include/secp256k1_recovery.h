@@ -106,6 +106,75 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int rustsecp256k1_v0_8_1_ecdsa_recove
     const unsigned char *msghash32
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(3) SECP256K1_ARG_NONNULL(4);
 
+/** Recover the ECDSA public keys of a batch of signatures.
+ *
+ *  Equivalent to calling rustsecp256k1_v0_8_1_ecdsa_recover for every signature, but the
+ *  inversions of the r values and of the Z coordinates of the recovered keys are shared by up
+ *  to 64 signatures at a time.
+ *
+ *  Returns: 1: all public keys were successfully recovered.
+ *           0: some public key could not be recovered, its pubkeys entry is zeroed out.
+ *  Args:    ctx:       pointer to a context object.
+ *  Out:     pubkeys:   pointer to an array of n recovered public keys.
+ *  In:      sigs:      pointer to an array of n pointers to signatures that support pubkey recovery.
+ *           msghash32: pointer to an array of n pointers to the 32-byte message hashes assumed to
+ *                      be signed.
+ *           n:         number of signatures.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int rustsecp256k1_v0_8_1_ecdsa_recover_batch(
+    const rustsecp256k1_v0_8_1_context* ctx,
+    rustsecp256k1_v0_8_1_pubkey *pubkeys,
+    const rustsecp256k1_v0_8_1_ecdsa_recoverable_signature *const *sigs,
+    const unsigned char *const *msghash32,
+    size_t n
+) SECP256K1_ARG_NONNULL(1);
+
+/** Determine the scratch space size with which rustsecp256k1_v0_8_1_ecdsa_recoverable_verify_batch
+ *  can verify a batch of n_sigs signatures in a single multi-scalar
+ *  multiplication.
+ *
+ *  Returns: the scratch space size to pass to
+ *           rustsecp256k1_v0_8_1_scratch_space_preallocated_size.
+ *  In:      n_sigs: number of signatures in the batch.
+ */
+SECP256K1_API size_t rustsecp256k1_v0_8_1_ecdsa_recoverable_verify_batch_scratch_size(
+    size_t n_sigs
+) SECP256K1_WARN_UNUSED_RESULT;
+
+/** Verify a batch of ECDSA signatures that carry a recovery id.
+ *
+ *  The recovery id determines the R point of every signature, so the
+ *  verification equations can be combined with pseudorandom weights into a
+ *  single multi-scalar multiplication, which is considerably faster than
+ *  verifying the signatures one by one. If the combined check fails, the
+ *  signatures are verified one by one to find the incorrect one.
+ *
+ *  The result is the same as calling rustsecp256k1_v0_8_1_ecdsa_verify on every signature
+ *  (converted with rustsecp256k1_v0_8_1_ecdsa_recoverable_signature_convert).
+ *
+ *  Returns: 1: all signatures are correct
+ *           0: at least one signature is incorrect
+ *  Args:    ctx:          a secp256k1 context object.
+ *           scratch:      scratch space used for the multi-scalar multiplication.
+ *                         If NULL, or too small, the signatures are verified
+ *                         one by one.
+ *  Out:     failed_index: if not NULL and 0 is returned, set to the index of the
+ *                         first incorrect signature.
+ *  In:      sigs:         array of pointers to the signatures being verified.
+ *           msghash32:    array of pointers to the 32-byte message hashes.
+ *           pubkeys:      array of pointers to the public keys to verify with.
+ *           n_sigs:       number of signatures in the batch.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int rustsecp256k1_v0_8_1_ecdsa_recoverable_verify_batch(
+    const rustsecp256k1_v0_8_1_context* ctx,
+    rustsecp256k1_v0_8_1_scratch_space *scratch,
+    size_t *failed_index,
+    const rustsecp256k1_v0_8_1_ecdsa_recoverable_signature *const *sigs,
+    const unsigned char *const *msghash32,
+    const rustsecp256k1_v0_8_1_pubkey *const *pubkeys,
+    size_t n_sigs
+) SECP256K1_ARG_NONNULL(1);
+
 #ifdef __cplusplus
 }
 #endif
@@ -157,6 +157,33 @@ SECP256K1_API int rustsecp256k1_v0_8_1_schnorrsig_sign_custom(
     rustsecp256k1_v0_8_1_schnorrsig_extraparams *extraparams
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(5);
 
+/** Create a batch of Schnorr signatures of 32-byte messages.
+ *
+ *  Each signature is identical to the one rustsecp256k1_v0_8_1_schnorrsig_sign32 creates
+ *  with the same auxiliary randomness, but the nonces and challenges are hashed
+ *  eight at a time and the conversions of the nonce points to affine coordinates
+ *  share a field inversion.
+ *
+ *  Returns 1 if all signatures were created, 0 if some keypair was invalid. The
+ *  signature of an invalid keypair is zeroed, all others are created.
+ *  Args:    ctx: pointer to a context object (not rustsecp256k1_v0_8_1_context_static).
+ *  Out:   sig64: pointer to an array of n 64-byte signatures.
+ *  In:    msg32: pointer to an array of n pointers to 32-byte messages.
+ *      keypairs: pointer to an array of n pointers to initialized keypairs.
+ *    aux_rand32: pointer to an array of n pointers to 32 bytes of fresh randomness, any
+ *                of which may be NULL (see rustsecp256k1_v0_8_1_schnorrsig_sign32). Can be
+ *                NULL to sign all messages without auxiliary randomness.
+ *             n: the number of signatures to create.
+ */
+SECP256K1_API int rustsecp256k1_v0_8_1_schnorrsig_sign_batch(
+    const rustsecp256k1_v0_8_1_context* ctx,
+    unsigned char *sig64,
+    const unsigned char *const *msg32,
+    const rustsecp256k1_v0_8_1_keypair *const *keypairs,
+    const unsigned char *const *aux_rand32,
+    size_t n
+) SECP256K1_ARG_NONNULL(1);
+
 /** Verify a Schnorr signature.
  *
  *  Returns: 1: correct signature
@@ -175,6 +202,68 @@ SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int rustsecp256k1_v0_8_1_schnorrsig_v
     const rustsecp256k1_v0_8_1_xonly_pubkey *pubkey
 ) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(5);
 
+/** Verify a Schnorr signature against a prepared public key.
+ *
+ *  Same as rustsecp256k1_v0_8_1_schnorrsig_verify, but faster as the multiples of the
+ *  public key do not need to be recomputed.
+ *
+ *  Returns: 1: correct signature
+ *           0: incorrect signature
+ *  Args:    ctx: a secp256k1 context object.
+ *  In:    sig64: pointer to the 64-byte signature to verify.
+ *           msg: the message being verified. Can only be NULL if msglen is 0.
+ *        msglen: length of the message
+ *      prepared: pointer to a public key with even Y coordinate (such as the one
+ *                converted from an x-only public key with rustsecp256k1_v0_8_1_xonly_pubkey_serialize
+ *                and rustsecp256k1_v0_8_1_ec_pubkey_parse), prepared with
+ *                rustsecp256k1_v0_8_1_ec_pubkey_prepare (cannot be NULL)
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int rustsecp256k1_v0_8_1_schnorrsig_verify_prepared(
+    const rustsecp256k1_v0_8_1_context* ctx,
+    const unsigned char *sig64,
+    const unsigned char *msg,
+    size_t msglen,
+    const rustsecp256k1_v0_8_1_prepared_pubkey *prepared
+) SECP256K1_ARG_NONNULL(1) SECP256K1_ARG_NONNULL(2) SECP256K1_ARG_NONNULL(5);
+
+/** Determine the scratch space size with which rustsecp256k1_v0_8_1_schnorrsig_verify_batch
+ *  can verify a batch of n_sigs signatures in a single multi-scalar
+ *  multiplication.
+ *
+ *  Returns: the scratch space size to pass to
+ *           rustsecp256k1_v0_8_1_scratch_space_preallocated_size.
+ *  In:      n_sigs: number of signatures in the batch.
+ */
+SECP256K1_API size_t rustsecp256k1_v0_8_1_schnorrsig_verify_batch_scratch_size(
+    size_t n_sigs
+) SECP256K1_WARN_UNUSED_RESULT;
+
+/** Verify a batch of Schnorr signatures over 32-byte messages.
+ *
+ *  All signatures are checked at once by combining the individual verification
+ *  equations with pseudorandom weights into a single multi-scalar
+ *  multiplication. This is considerably faster than verifying the signatures
+ *  one by one, but does not reveal which signature is invalid.
+ *
+ *  Returns: 1: all signatures are correct (or n_sigs is 0)
+ *           0: at least one signature is incorrect, or the computation failed
+ *  Args:    ctx: a secp256k1 context object.
+ *       scratch: scratch space used for the multi-scalar multiplication. If
+ *                NULL, or too small, the points are multiplied one by one.
+ *  In:    sig64: array of pointers to 64-byte signatures.
+ *         msg32: array of pointers to the 32-byte messages being verified.
+ *       pubkeys: array of pointers to the x-only public keys to verify with.
+ *        n_sigs: number of signatures in the batch.
+ */
+SECP256K1_API SECP256K1_WARN_UNUSED_RESULT int rustsecp256k1_v0_8_1_schnorrsig_verify_batch(
+    const rustsecp256k1_v0_8_1_context* ctx,
+    rustsecp256k1_v0_8_1_scratch_space *scratch,
+    const unsigned char *const *sig64,
+    const unsigned char *const *msg32,
+    const rustsecp256k1_v0_8_1_xonly_pubkey *const *pubkeys,
+    size_t n_sigs
+) SECP256K1_ARG_NONNULL(1);
+
 #ifdef __cplusplus
 }
 #endif
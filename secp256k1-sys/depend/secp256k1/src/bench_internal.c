@@ -320,6 +320,61 @@ void bench_sha256(void* arg, int iters) {
     }
 }
 
+void bench_sha256_transform(void* arg, int iters) {
+    int i;
+    bench_inv *data = (bench_inv*)arg;
+    uint32_t s[8] = {0};
+
+    for (i = 0; i < iters; i++) {
+        rustsecp256k1_v0_8_1_sha256_transform(s, data->data);
+    }
+    CHECK(s[0] != 0);
+}
+
+void bench_sha256_transform_portable(void* arg, int iters) {
+    int i;
+    bench_inv *data = (bench_inv*)arg;
+    uint32_t s[8] = {0};
+
+    for (i = 0; i < iters; i++) {
+        rustsecp256k1_v0_8_1_sha256_transform_portable(s, data->data);
+    }
+    CHECK(s[0] != 0);
+}
+
+/* Eight blocks per call, so that the time per block compares with hash_sha256_transform. */
+void bench_sha256_transform_x8(void* arg, int iters) {
+    int i, k;
+    bench_inv *data = (bench_inv*)arg;
+    rustsecp256k1_v0_8_1_sha256 hash[8];
+
+    memset(hash, 0, sizeof(hash));
+    for (k = 0; k < 8; k++) {
+        memcpy(hash[k].buf, data->data, 64);
+    }
+    for (i = 0; i < iters; i += 8) {
+        rustsecp256k1_v0_8_1_sha256_transform_x8(hash);
+    }
+    CHECK(hash[0].s[0] != 0);
+}
+
+#if defined(USE_AVX2_DISPATCH)
+void bench_sha256_transform_x8_avx2(void* arg, int iters) {
+    int i, k;
+    bench_inv *data = (bench_inv*)arg;
+    rustsecp256k1_v0_8_1_sha256 hash[8];
+
+    memset(hash, 0, sizeof(hash));
+    for (k = 0; k < 8; k++) {
+        memcpy(hash[k].buf, data->data, 64);
+    }
+    for (i = 0; i < iters; i += 8) {
+        rustsecp256k1_v0_8_1_sha256_transform_x8_avx2(hash);
+    }
+    CHECK(hash[0].s[0] != 0);
+}
+#endif
+
 void bench_hmac_sha256(void* arg, int iters) {
     int i;
     bench_inv *data = (bench_inv*)arg;
@@ -384,6 +439,13 @@ int main(int argc, char **argv) {
     if (d || have_flag(argc, argv, "ecmult") || have_flag(argc, argv, "wnaf")) run_benchmark("ecmult_wnaf", bench_ecmult_wnaf, bench_setup, NULL, &data, 10, iters);
 
     if (d || have_flag(argc, argv, "hash") || have_flag(argc, argv, "sha256")) run_benchmark("hash_sha256", bench_sha256, bench_setup, NULL, &data, 10, iters);
+    if (d || have_flag(argc, argv, "hash") || have_flag(argc, argv, "transform")) run_benchmark("hash_sha256_transform", bench_sha256_transform, bench_setup, NULL, &data, 10, iters*10);
+    if (d || have_flag(argc, argv, "hash") || have_flag(argc, argv, "transform")) run_benchmark("hash_sha256_transform_portable", bench_sha256_transform_portable, bench_setup, NULL, &data, 10, iters*10);
+    if (d || have_flag(argc, argv, "hash") || have_flag(argc, argv, "transform")) run_benchmark("hash_sha256_transform_x8", bench_sha256_transform_x8, bench_setup, NULL, &data, 10, iters*10);
+#if defined(USE_AVX2_DISPATCH)
+    /* The dispatch prefers the SHA extensions, so time the AVX2 transform on its own as well. */
+    if (rustsecp256k1_v0_8_1_have_avx2() && (d || have_flag(argc, argv, "hash") || have_flag(argc, argv, "transform"))) run_benchmark("hash_sha256_transform_x8_avx2", bench_sha256_transform_x8_avx2, bench_setup, NULL, &data, 10, iters*10);
+#endif
     if (d || have_flag(argc, argv, "hash") || have_flag(argc, argv, "hmac")) run_benchmark("hash_hmac_sha256", bench_hmac_sha256, bench_setup, NULL, &data, 10, iters);
     if (d || have_flag(argc, argv, "hash") || have_flag(argc, argv, "rng6979")) run_benchmark("hash_rfc6979_hmac_sha256", bench_rfc6979_hmac_sha256, bench_setup, NULL, &data, 10, iters);
 
@@ -204,25 +204,14 @@ static int rustsecp256k1_v0_8_1_ecdsa_sig_serialize(unsigned char *sig, size_t *
     return 1;
 }
 
-static int rustsecp256k1_v0_8_1_ecdsa_sig_verify(const rustsecp256k1_v0_8_1_scalar *sigr, const rustsecp256k1_v0_8_1_scalar *sigs, const rustsecp256k1_v0_8_1_ge *pubkey, const rustsecp256k1_v0_8_1_scalar *message) {
+/* Checks that r is the x coordinate (modulo n) of the recomputed R point pr. */
+static int rustsecp256k1_v0_8_1_ecdsa_sig_r_matches(const rustsecp256k1_v0_8_1_scalar *sigr, const rustsecp256k1_v0_8_1_gej *pr) {
     unsigned char c[32];
-    rustsecp256k1_v0_8_1_scalar sn, u1, u2;
 #if !defined(EXHAUSTIVE_TEST_ORDER)
     rustsecp256k1_v0_8_1_fe xr;
 #endif
-    rustsecp256k1_v0_8_1_gej pubkeyj;
-    rustsecp256k1_v0_8_1_gej pr;
 
-    if (rustsecp256k1_v0_8_1_scalar_is_zero(sigr) || rustsecp256k1_v0_8_1_scalar_is_zero(sigs)) {
-        return 0;
-    }
-
-    rustsecp256k1_v0_8_1_scalar_inverse_var(&sn, sigs);
-    rustsecp256k1_v0_8_1_scalar_mul(&u1, &sn, message);
-    rustsecp256k1_v0_8_1_scalar_mul(&u2, &sn, sigr);
-    rustsecp256k1_v0_8_1_gej_set_ge(&pubkeyj, pubkey);
-    rustsecp256k1_v0_8_1_ecmult(&pr, &pubkeyj, &u2, &u1);
-    if (rustsecp256k1_v0_8_1_gej_is_infinity(&pr)) {
+    if (rustsecp256k1_v0_8_1_gej_is_infinity(pr)) {
         return 0;
     }
 
@@ -230,7 +219,7 @@ static int rustsecp256k1_v0_8_1_ecdsa_sig_verify(const rustsecp256k1_v0_8_1_scal
 {
     rustsecp256k1_v0_8_1_scalar computed_r;
     rustsecp256k1_v0_8_1_ge pr_ge;
-    rustsecp256k1_v0_8_1_ge_set_gej(&pr_ge, &pr);
+    rustsecp256k1_v0_8_1_ge_set_gej(&pr_ge, pr);
     rustsecp256k1_v0_8_1_fe_normalize(&pr_ge.x);
 
     rustsecp256k1_v0_8_1_fe_get_b32(c, &pr_ge.x);
@@ -257,7 +246,7 @@ static int rustsecp256k1_v0_8_1_ecdsa_sig_verify(const rustsecp256k1_v0_8_1_scal
      *  Thus, we can avoid the inversion, but we have to check both cases separately.
      *  rustsecp256k1_v0_8_1_gej_eq_x implements the (xr * pr.z^2 mod p == pr.x) test.
      */
-    if (rustsecp256k1_v0_8_1_gej_eq_x_var(&xr, &pr)) {
+    if (rustsecp256k1_v0_8_1_gej_eq_x_var(&xr, pr)) {
         /* xr * pr.z^2 mod p == pr.x, so the signature is valid. */
         return 1;
     }
@@ -266,7 +255,7 @@ static int rustsecp256k1_v0_8_1_ecdsa_sig_verify(const rustsecp256k1_v0_8_1_scal
         return 0;
     }
     rustsecp256k1_v0_8_1_fe_add(&xr, &rustsecp256k1_v0_8_1_ecdsa_const_order_as_fe);
-    if (rustsecp256k1_v0_8_1_gej_eq_x_var(&xr, &pr)) {
+    if (rustsecp256k1_v0_8_1_gej_eq_x_var(&xr, pr)) {
         /* (xr + n) * pr.z^2 mod p == pr.x, so the signature is valid. */
         return 1;
     }
@@ -274,6 +263,50 @@ static int rustsecp256k1_v0_8_1_ecdsa_sig_verify(const rustsecp256k1_v0_8_1_scal
 #endif
 }
 
+/* Verifies a signature given the inverse sn of its (nonzero) s value, so that
+ * callers verifying many signatures can share the inversions. */
+static int rustsecp256k1_v0_8_1_ecdsa_sig_verify_sinv(const rustsecp256k1_v0_8_1_scalar *sigr, const rustsecp256k1_v0_8_1_scalar *sn, const rustsecp256k1_v0_8_1_ge *pubkey, const rustsecp256k1_v0_8_1_scalar *message) {
+    rustsecp256k1_v0_8_1_scalar u1, u2;
+    rustsecp256k1_v0_8_1_gej pubkeyj;
+    rustsecp256k1_v0_8_1_gej pr;
+
+    if (rustsecp256k1_v0_8_1_scalar_is_zero(sigr)) {
+        return 0;
+    }
+
+    rustsecp256k1_v0_8_1_scalar_mul(&u1, sn, message);
+    rustsecp256k1_v0_8_1_scalar_mul(&u2, sn, sigr);
+    rustsecp256k1_v0_8_1_gej_set_ge(&pubkeyj, pubkey);
+    rustsecp256k1_v0_8_1_ecmult(&pr, &pubkeyj, &u2, &u1);
+    return rustsecp256k1_v0_8_1_ecdsa_sig_r_matches(sigr, &pr);
+}
+
+static int rustsecp256k1_v0_8_1_ecdsa_sig_verify(const rustsecp256k1_v0_8_1_scalar *sigr, const rustsecp256k1_v0_8_1_scalar *sigs, const rustsecp256k1_v0_8_1_ge *pubkey, const rustsecp256k1_v0_8_1_scalar *message) {
+    rustsecp256k1_v0_8_1_scalar sn;
+
+    if (rustsecp256k1_v0_8_1_scalar_is_zero(sigr) || rustsecp256k1_v0_8_1_scalar_is_zero(sigs)) {
+        return 0;
+    }
+
+    rustsecp256k1_v0_8_1_scalar_inverse_var(&sn, sigs);
+    return rustsecp256k1_v0_8_1_ecdsa_sig_verify_sinv(sigr, &sn, pubkey, message);
+}
+
+static int rustsecp256k1_v0_8_1_ecdsa_sig_verify_prepared(const rustsecp256k1_v0_8_1_scalar *sigr, const rustsecp256k1_v0_8_1_scalar *sigs, const rustsecp256k1_v0_8_1_ge_storage *pre, const rustsecp256k1_v0_8_1_scalar *message) {
+    rustsecp256k1_v0_8_1_scalar sn, u1, u2;
+    rustsecp256k1_v0_8_1_gej pr;
+
+    if (rustsecp256k1_v0_8_1_scalar_is_zero(sigr) || rustsecp256k1_v0_8_1_scalar_is_zero(sigs)) {
+        return 0;
+    }
+
+    rustsecp256k1_v0_8_1_scalar_inverse_var(&sn, sigs);
+    rustsecp256k1_v0_8_1_scalar_mul(&u1, &sn, message);
+    rustsecp256k1_v0_8_1_scalar_mul(&u2, &sn, sigr);
+    rustsecp256k1_v0_8_1_ecmult_prepared(&pr, pre, &u2, &u1);
+    return rustsecp256k1_v0_8_1_ecdsa_sig_r_matches(sigr, &pr);
+}
+
 static int rustsecp256k1_v0_8_1_ecdsa_sig_sign(const rustsecp256k1_v0_8_1_ecmult_gen_context *ctx, rustsecp256k1_v0_8_1_scalar *sigr, rustsecp256k1_v0_8_1_scalar *sigs, const rustsecp256k1_v0_8_1_scalar *seckey, const rustsecp256k1_v0_8_1_scalar *message, const rustsecp256k1_v0_8_1_scalar *nonce, int *recid) {
     unsigned char b[32];
     rustsecp256k1_v0_8_1_gej rp;
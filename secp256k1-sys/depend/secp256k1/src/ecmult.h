@@ -43,6 +43,23 @@
 /** Double multiply: R = na*A + ng*G */
 static void rustsecp256k1_v0_8_1_ecmult(rustsecp256k1_v0_8_1_gej *r, const rustsecp256k1_v0_8_1_gej *a, const rustsecp256k1_v0_8_1_scalar *na, const rustsecp256k1_v0_8_1_scalar *ng);
 
+/** Window size of the tables of a fixed point A built by ecmult_prepare_table. Wider than
+ *  the window used for A by ecmult, as the table is built once and reused across many
+ *  multiplications. */
+#if defined(EXHAUSTIVE_TEST_ORDER)
+#  define ECMULT_PREPARED_WINDOW 2
+#else
+#  define ECMULT_PREPARED_WINDOW 8
+#endif
+
+/** Fill pre with the affine odd multiples [1*a,3*a,...,(2*n-1)*a] of a, where
+ *  n = ECMULT_TABLE_SIZE(ECMULT_PREPARED_WINDOW). */
+static void rustsecp256k1_v0_8_1_ecmult_prepare_table(rustsecp256k1_v0_8_1_ge_storage *pre, const rustsecp256k1_v0_8_1_ge *a);
+
+/** Double multiply with a prepared table: R = na*A + ng*G, where pre was filled from A by
+ *  ecmult_prepare_table. */
+static void rustsecp256k1_v0_8_1_ecmult_prepared(rustsecp256k1_v0_8_1_gej *r, const rustsecp256k1_v0_8_1_ge_storage *pre, const rustsecp256k1_v0_8_1_scalar *na, const rustsecp256k1_v0_8_1_scalar *ng);
+
 typedef int (rustsecp256k1_v0_8_1_ecmult_multi_callback)(rustsecp256k1_v0_8_1_scalar *sc, rustsecp256k1_v0_8_1_ge *pt, size_t idx, void *data);
 
 /**
@@ -130,33 +130,48 @@ static int rustsecp256k1_v0_8_1_wnaf_const(int *wnaf, const rustsecp256k1_v0_8_1
     return skew;
 }
 
-static void rustsecp256k1_v0_8_1_ecmult_const(rustsecp256k1_v0_8_1_gej *r, const rustsecp256k1_v0_8_1_ge *a, const rustsecp256k1_v0_8_1_scalar *scalar, int size) {
-    rustsecp256k1_v0_8_1_ge pre_a[ECMULT_TABLE_SIZE(WINDOW_A)];
-    rustsecp256k1_v0_8_1_ge tmpa;
-    rustsecp256k1_v0_8_1_fe Z;
-
+/** The recoding of a scalar for ecmult_const, which only depends on the scalar and can be
+ *  reused to multiply several points by it. */
+typedef struct {
+    int size;
     int skew_1;
-    rustsecp256k1_v0_8_1_ge pre_a_lam[ECMULT_TABLE_SIZE(WINDOW_A)];
-    int wnaf_lam[1 + WNAF_SIZE(WINDOW_A - 1)];
     int skew_lam;
-    rustsecp256k1_v0_8_1_scalar q_1, q_lam;
     int wnaf_1[1 + WNAF_SIZE(WINDOW_A - 1)];
+    int wnaf_lam[1 + WNAF_SIZE(WINDOW_A - 1)];
+} rustsecp256k1_v0_8_1_ecmult_const_recoding;
 
-    int i;
+static void rustsecp256k1_v0_8_1_ecmult_const_recode(rustsecp256k1_v0_8_1_ecmult_const_recoding *rec, const rustsecp256k1_v0_8_1_scalar *scalar, int size) {
+    rustsecp256k1_v0_8_1_scalar q_1, q_lam;
 
     /* build wnaf representation for q. */
-    int rsize = size;
+    rec->size = size;
     if (size > 128) {
-        rsize = 128;
         /* split q into q_1 and q_lam (where q = q_1 + q_lam*lambda, and q_1 and q_lam are ~128 bit) */
         rustsecp256k1_v0_8_1_scalar_split_lambda(&q_1, &q_lam, scalar);
-        skew_1   = rustsecp256k1_v0_8_1_wnaf_const(wnaf_1,   &q_1,   WINDOW_A - 1, 128);
-        skew_lam = rustsecp256k1_v0_8_1_wnaf_const(wnaf_lam, &q_lam, WINDOW_A - 1, 128);
+        rec->skew_1   = rustsecp256k1_v0_8_1_wnaf_const(rec->wnaf_1,   &q_1,   WINDOW_A - 1, 128);
+        rec->skew_lam = rustsecp256k1_v0_8_1_wnaf_const(rec->wnaf_lam, &q_lam, WINDOW_A - 1, 128);
     } else
     {
-        skew_1   = rustsecp256k1_v0_8_1_wnaf_const(wnaf_1, scalar, WINDOW_A - 1, size);
-        skew_lam = 0;
+        rec->skew_1   = rustsecp256k1_v0_8_1_wnaf_const(rec->wnaf_1, scalar, WINDOW_A - 1, size);
+        rec->skew_lam = 0;
     }
+}
+
+/** Like ecmult_const, for a scalar recoded with ecmult_const_recode. */
+static void rustsecp256k1_v0_8_1_ecmult_const_recoded(rustsecp256k1_v0_8_1_gej *r, const rustsecp256k1_v0_8_1_ge *a, const rustsecp256k1_v0_8_1_ecmult_const_recoding *rec) {
+    rustsecp256k1_v0_8_1_ge pre_a[ECMULT_TABLE_SIZE(WINDOW_A)];
+    rustsecp256k1_v0_8_1_ge tmpa;
+    rustsecp256k1_v0_8_1_fe Z;
+
+    const int size = rec->size;
+    const int skew_1 = rec->skew_1;
+    const int skew_lam = rec->skew_lam;
+    const int *wnaf_1 = rec->wnaf_1;
+    const int *wnaf_lam = rec->wnaf_lam;
+    rustsecp256k1_v0_8_1_ge pre_a_lam[ECMULT_TABLE_SIZE(WINDOW_A)];
+
+    int i;
+    int rsize = size > 128 ? 128 : size;
 
     /* Calculate odd multiples of a.
      * All multiples are brought to the same Z 'denominator', which is stored
@@ -228,4 +243,11 @@ static void rustsecp256k1_v0_8_1_ecmult_const(rustsecp256k1_v0_8_1_gej *r, const
     rustsecp256k1_v0_8_1_fe_mul(&r->z, &r->z, &Z);
 }
 
+static void rustsecp256k1_v0_8_1_ecmult_const(rustsecp256k1_v0_8_1_gej *r, const rustsecp256k1_v0_8_1_ge *a, const rustsecp256k1_v0_8_1_scalar *scalar, int size) {
+    rustsecp256k1_v0_8_1_ecmult_const_recoding rec;
+
+    rustsecp256k1_v0_8_1_ecmult_const_recode(&rec, scalar, size);
+    rustsecp256k1_v0_8_1_ecmult_const_recoded(r, a, &rec);
+}
+
 #endif /* SECP256K1_ECMULT_CONST_IMPL_H */
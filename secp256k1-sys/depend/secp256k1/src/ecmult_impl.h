@@ -353,6 +353,86 @@ static void rustsecp256k1_v0_8_1_ecmult(rustsecp256k1_v0_8_1_gej *r, const rusts
     rustsecp256k1_v0_8_1_ecmult_strauss_wnaf(&state, r, 1, a, na, ng);
 }
 
+static void rustsecp256k1_v0_8_1_ecmult_prepare_table(rustsecp256k1_v0_8_1_ge_storage *pre, const rustsecp256k1_v0_8_1_ge *a) {
+    rustsecp256k1_v0_8_1_ge pre_a[ECMULT_TABLE_SIZE(ECMULT_PREPARED_WINDOW)];
+    rustsecp256k1_v0_8_1_fe zr[ECMULT_TABLE_SIZE(ECMULT_PREPARED_WINDOW)];
+    rustsecp256k1_v0_8_1_fe z;
+    rustsecp256k1_v0_8_1_gej aj;
+    int i;
+
+    VERIFY_CHECK(!a->infinity);
+
+    /* Compute the multiples with a common Z denominator and divide it out with a
+     * single inversion. */
+    rustsecp256k1_v0_8_1_gej_set_ge(&aj, a);
+    rustsecp256k1_v0_8_1_ecmult_odd_multiples_table(ECMULT_TABLE_SIZE(ECMULT_PREPARED_WINDOW), pre_a, zr, &z, &aj);
+    rustsecp256k1_v0_8_1_ge_table_set_globalz(ECMULT_TABLE_SIZE(ECMULT_PREPARED_WINDOW), pre_a, zr);
+    rustsecp256k1_v0_8_1_fe_inv_var(&z, &z);
+    for (i = 0; i < ECMULT_TABLE_SIZE(ECMULT_PREPARED_WINDOW); i++) {
+        rustsecp256k1_v0_8_1_gej tmpa;
+        rustsecp256k1_v0_8_1_ge p;
+        tmpa.x = pre_a[i].x;
+        tmpa.y = pre_a[i].y;
+        tmpa.infinity = 0;
+        rustsecp256k1_v0_8_1_ge_set_gej_zinv(&p, &tmpa, &z);
+        rustsecp256k1_v0_8_1_ge_to_storage(&pre[i], &p);
+    }
+}
+
+static void rustsecp256k1_v0_8_1_ecmult_prepared(rustsecp256k1_v0_8_1_gej *r, const rustsecp256k1_v0_8_1_ge_storage *pre, const rustsecp256k1_v0_8_1_scalar *na, const rustsecp256k1_v0_8_1_scalar *ng) {
+    rustsecp256k1_v0_8_1_ge tmpa;
+    rustsecp256k1_v0_8_1_scalar na_1, na_lam, ng_1, ng_128;
+    int wnaf_na_1[129], wnaf_na_lam[129], wnaf_ng_1[129], wnaf_ng_128[129];
+    int bits_na_1, bits_na_lam, bits_ng_1, bits_ng_128;
+    int bits;
+    int i;
+
+    /* split na into na_1 and na_lam (where na = na_1 + na_lam*lambda, and na_1 and na_lam are ~128 bit) */
+    rustsecp256k1_v0_8_1_scalar_split_lambda(&na_1, &na_lam, na);
+    bits_na_1   = rustsecp256k1_v0_8_1_ecmult_wnaf(wnaf_na_1,   129, &na_1,   ECMULT_PREPARED_WINDOW);
+    bits_na_lam = rustsecp256k1_v0_8_1_ecmult_wnaf(wnaf_na_lam, 129, &na_lam, ECMULT_PREPARED_WINDOW);
+    /* split ng into ng_1 and ng_128 (where gn = gn_1 + gn_128*2^128, and gn_1 and gn_128 are ~128 bit) */
+    rustsecp256k1_v0_8_1_scalar_split_128(&ng_1, &ng_128, ng);
+    bits_ng_1   = rustsecp256k1_v0_8_1_ecmult_wnaf(wnaf_ng_1,   129, &ng_1,   WINDOW_G);
+    bits_ng_128 = rustsecp256k1_v0_8_1_ecmult_wnaf(wnaf_ng_128, 129, &ng_128, WINDOW_G);
+
+    bits = bits_na_1;
+    if (bits_na_lam > bits) {
+        bits = bits_na_lam;
+    }
+    if (bits_ng_1 > bits) {
+        bits = bits_ng_1;
+    }
+    if (bits_ng_128 > bits) {
+        bits = bits_ng_128;
+    }
+
+    /* All table entries are affine, so every addition is a mixed one and no Z
+     * correction is needed at the end. */
+    rustsecp256k1_v0_8_1_gej_set_infinity(r);
+    for (i = bits - 1; i >= 0; i--) {
+        int n;
+        rustsecp256k1_v0_8_1_gej_double_var(r, r, NULL);
+        if (i < bits_na_1 && (n = wnaf_na_1[i])) {
+            rustsecp256k1_v0_8_1_ecmult_table_get_ge_storage(&tmpa, pre, n, ECMULT_PREPARED_WINDOW);
+            rustsecp256k1_v0_8_1_gej_add_ge_var(r, r, &tmpa, NULL);
+        }
+        if (i < bits_na_lam && (n = wnaf_na_lam[i])) {
+            rustsecp256k1_v0_8_1_ecmult_table_get_ge_storage(&tmpa, pre, n, ECMULT_PREPARED_WINDOW);
+            rustsecp256k1_v0_8_1_ge_mul_lambda(&tmpa, &tmpa);
+            rustsecp256k1_v0_8_1_gej_add_ge_var(r, r, &tmpa, NULL);
+        }
+        if (i < bits_ng_1 && (n = wnaf_ng_1[i])) {
+            rustsecp256k1_v0_8_1_ecmult_table_get_ge_storage(&tmpa, rustsecp256k1_v0_8_1_pre_g, n, WINDOW_G);
+            rustsecp256k1_v0_8_1_gej_add_ge_var(r, r, &tmpa, NULL);
+        }
+        if (i < bits_ng_128 && (n = wnaf_ng_128[i])) {
+            rustsecp256k1_v0_8_1_ecmult_table_get_ge_storage(&tmpa, rustsecp256k1_v0_8_1_pre_g_128, n, WINDOW_G);
+            rustsecp256k1_v0_8_1_gej_add_ge_var(r, r, &tmpa, NULL);
+        }
+    }
+}
+
 static size_t rustsecp256k1_v0_8_1_strauss_scratch_size(size_t n_points) {
     static const size_t point_size = (sizeof(rustsecp256k1_v0_8_1_ge) + sizeof(rustsecp256k1_v0_8_1_fe)) * ECMULT_TABLE_SIZE(WINDOW_A) + sizeof(struct rustsecp256k1_v0_8_1_strauss_point_state) + sizeof(rustsecp256k1_v0_8_1_gej) + sizeof(rustsecp256k1_v0_8_1_scalar);
     return n_points*point_size;
@@ -111,6 +111,12 @@ static void rustsecp256k1_v0_8_1_fe_sqr(rustsecp256k1_v0_8_1_fe *r, const rustse
  *  itself. */
 static int rustsecp256k1_v0_8_1_fe_sqrt(rustsecp256k1_v0_8_1_fe *r, const rustsecp256k1_v0_8_1_fe *a);
 
+#if defined(USE_AVX2_DISPATCH)
+/** Compute the square roots of four field elements like fe_sqrt, setting ret[k] to whether r[k] is
+ *  a square root of a[k]. The outputs are normalized. Must only be called if have_avx2() returns 1. */
+static void rustsecp256k1_v0_8_1_fe_sqrt_x4(rustsecp256k1_v0_8_1_fe *r, int *ret, const rustsecp256k1_v0_8_1_fe *a);
+#endif
+
 /** Sets a field element to be the (modular) inverse of another. Requires the input's magnitude to be
  *  at most 8. The output magnitude is 1 (but not guaranteed to be normalized). */
 static void rustsecp256k1_v0_8_1_fe_inv(rustsecp256k1_v0_8_1_fe *r, const rustsecp256k1_v0_8_1_fe *a);
@@ -135,4 +135,402 @@ static int rustsecp256k1_v0_8_1_fe_sqrt(rustsecp256k1_v0_8_1_fe *r, const rustse
     return rustsecp256k1_v0_8_1_fe_equal(&t1, a);
 }
 
+#if defined(USE_AVX2_DISPATCH)
+#include <immintrin.h>
+
+/** Four field elements in the 64-bit lanes of AVX2 registers, using the limbs of field_10x26.h:
+ *  n[i] holds limb i of every element. Limbs of 26 bits make all limb products fit the 32x32->64
+ *  bit multiplications AVX2 has, so that the operations below can follow fe_mul_inner and
+ *  fe_sqr_inner of field_10x26_impl.h lane by lane, with the same bounds. */
+typedef struct {
+    __m256i n[10];
+} rustsecp256k1_v0_8_1_fe_x4;
+
+/** Reduce the 19 columns p of a product modulo the field prime, with the carries of
+ *  fe_mul_inner: columns 10 to 18 are folded into columns 0 to 8 as they are reached. */
+__attribute__((target("avx2")))
+static void rustsecp256k1_v0_8_1_fe_x4_reduce(rustsecp256k1_v0_8_1_fe_x4 *r, const __m256i *p) {
+    const __m256i M = _mm256_set1_epi64x(0x3FFFFFF), M9 = _mm256_set1_epi64x(0x3FFFFF);
+    const __m256i R0 = _mm256_set1_epi64x(0x3D10), R0s = _mm256_set1_epi64x(0x3D1);
+    __m256i c, d, u, t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+
+    d = p[9];
+    t9 = _mm256_and_si256(d, M); d = _mm256_srli_epi64(d, 26);
+    c = p[0];
+    d = _mm256_add_epi64(d, p[10]);
+    u = _mm256_and_si256(d, M); d = _mm256_srli_epi64(d, 26);
+    c = _mm256_add_epi64(c, _mm256_mul_epu32(u, R0));
+    t0 = _mm256_and_si256(c, M); c = _mm256_srli_epi64(c, 26);
+    c = _mm256_add_epi64(c, _mm256_slli_epi64(u, 10));
+    c = _mm256_add_epi64(c, p[1]);
+    d = _mm256_add_epi64(d, p[11]);
+    u = _mm256_and_si256(d, M); d = _mm256_srli_epi64(d, 26);
+    c = _mm256_add_epi64(c, _mm256_mul_epu32(u, R0));
+    t1 = _mm256_and_si256(c, M); c = _mm256_srli_epi64(c, 26);
+    c = _mm256_add_epi64(c, _mm256_slli_epi64(u, 10));
+    c = _mm256_add_epi64(c, p[2]);
+    d = _mm256_add_epi64(d, p[12]);
+    u = _mm256_and_si256(d, M); d = _mm256_srli_epi64(d, 26);
+    c = _mm256_add_epi64(c, _mm256_mul_epu32(u, R0));
+    t2 = _mm256_and_si256(c, M); c = _mm256_srli_epi64(c, 26);
+    c = _mm256_add_epi64(c, _mm256_slli_epi64(u, 10));
+    c = _mm256_add_epi64(c, p[3]);
+    d = _mm256_add_epi64(d, p[13]);
+    u = _mm256_and_si256(d, M); d = _mm256_srli_epi64(d, 26);
+    c = _mm256_add_epi64(c, _mm256_mul_epu32(u, R0));
+    t3 = _mm256_and_si256(c, M); c = _mm256_srli_epi64(c, 26);
+    c = _mm256_add_epi64(c, _mm256_slli_epi64(u, 10));
+    c = _mm256_add_epi64(c, p[4]);
+    d = _mm256_add_epi64(d, p[14]);
+    u = _mm256_and_si256(d, M); d = _mm256_srli_epi64(d, 26);
+    c = _mm256_add_epi64(c, _mm256_mul_epu32(u, R0));
+    t4 = _mm256_and_si256(c, M); c = _mm256_srli_epi64(c, 26);
+    c = _mm256_add_epi64(c, _mm256_slli_epi64(u, 10));
+    c = _mm256_add_epi64(c, p[5]);
+    d = _mm256_add_epi64(d, p[15]);
+    u = _mm256_and_si256(d, M); d = _mm256_srli_epi64(d, 26);
+    c = _mm256_add_epi64(c, _mm256_mul_epu32(u, R0));
+    t5 = _mm256_and_si256(c, M); c = _mm256_srli_epi64(c, 26);
+    c = _mm256_add_epi64(c, _mm256_slli_epi64(u, 10));
+    c = _mm256_add_epi64(c, p[6]);
+    d = _mm256_add_epi64(d, p[16]);
+    u = _mm256_and_si256(d, M); d = _mm256_srli_epi64(d, 26);
+    c = _mm256_add_epi64(c, _mm256_mul_epu32(u, R0));
+    t6 = _mm256_and_si256(c, M); c = _mm256_srli_epi64(c, 26);
+    c = _mm256_add_epi64(c, _mm256_slli_epi64(u, 10));
+    c = _mm256_add_epi64(c, p[7]);
+    d = _mm256_add_epi64(d, p[17]);
+    u = _mm256_and_si256(d, M); d = _mm256_srli_epi64(d, 26);
+    c = _mm256_add_epi64(c, _mm256_mul_epu32(u, R0));
+    t7 = _mm256_and_si256(c, M); c = _mm256_srli_epi64(c, 26);
+    c = _mm256_add_epi64(c, _mm256_slli_epi64(u, 10));
+    c = _mm256_add_epi64(c, p[8]);
+    d = _mm256_add_epi64(d, p[18]);
+    u = _mm256_and_si256(d, M); d = _mm256_srli_epi64(d, 26);
+    c = _mm256_add_epi64(c, _mm256_mul_epu32(u, R0));
+    t8 = _mm256_and_si256(c, M); c = _mm256_srli_epi64(c, 26);
+    c = _mm256_add_epi64(c, _mm256_slli_epi64(u, 10));
+
+    /* d has at most 31 bits here, so d * R0 fits a 32x32 bit multiplication. */
+    c = _mm256_add_epi64(c, _mm256_add_epi64(_mm256_mul_epu32(d, R0), t9));
+    r->n[9] = _mm256_and_si256(c, M9); c = _mm256_srli_epi64(c, 22);
+    c = _mm256_add_epi64(c, _mm256_slli_epi64(d, 14));
+
+    /* c has up to 46 bits, so c * (R0 >> 4) is computed from both 32-bit halves of c. */
+    d = _mm256_add_epi64(_mm256_mul_epu32(c, R0s), _mm256_slli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(c, 32), R0s), 32));
+    d = _mm256_add_epi64(d, t0);
+    r->n[0] = _mm256_and_si256(d, M); d = _mm256_srli_epi64(d, 26);
+    d = _mm256_add_epi64(d, _mm256_add_epi64(_mm256_slli_epi64(c, 6), t1));
+    r->n[1] = _mm256_and_si256(d, M); d = _mm256_srli_epi64(d, 26);
+    r->n[2] = _mm256_add_epi64(d, t2);
+    r->n[3] = t3;
+    r->n[4] = t4;
+    r->n[5] = t5;
+    r->n[6] = t6;
+    r->n[7] = t7;
+    r->n[8] = t8;
+}
+
+/** Multiply the elements of a and b lane by lane. Limbs of the inputs must fit in 30 bits, which
+ *  holds for the outputs of every function here. */
+__attribute__((target("avx2")))
+static void rustsecp256k1_v0_8_1_fe_x4_mul(rustsecp256k1_v0_8_1_fe_x4 *r, const rustsecp256k1_v0_8_1_fe_x4 *a, const rustsecp256k1_v0_8_1_fe_x4 *b) {
+    const __m256i *x = a->n, *y = b->n;
+    __m256i p[19];
+
+    /* The columns are written out, as loops over them are not unrolled and run from memory. */
+    p[0] = _mm256_mul_epu32(x[0], y[0]);
+    p[1] = _mm256_mul_epu32(x[0], y[1]);
+    p[1] = _mm256_add_epi64(p[1], _mm256_mul_epu32(x[1], y[0]));
+    p[2] = _mm256_mul_epu32(x[0], y[2]);
+    p[2] = _mm256_add_epi64(p[2], _mm256_mul_epu32(x[1], y[1]));
+    p[2] = _mm256_add_epi64(p[2], _mm256_mul_epu32(x[2], y[0]));
+    p[3] = _mm256_mul_epu32(x[0], y[3]);
+    p[3] = _mm256_add_epi64(p[3], _mm256_mul_epu32(x[1], y[2]));
+    p[3] = _mm256_add_epi64(p[3], _mm256_mul_epu32(x[2], y[1]));
+    p[3] = _mm256_add_epi64(p[3], _mm256_mul_epu32(x[3], y[0]));
+    p[4] = _mm256_mul_epu32(x[0], y[4]);
+    p[4] = _mm256_add_epi64(p[4], _mm256_mul_epu32(x[1], y[3]));
+    p[4] = _mm256_add_epi64(p[4], _mm256_mul_epu32(x[2], y[2]));
+    p[4] = _mm256_add_epi64(p[4], _mm256_mul_epu32(x[3], y[1]));
+    p[4] = _mm256_add_epi64(p[4], _mm256_mul_epu32(x[4], y[0]));
+    p[5] = _mm256_mul_epu32(x[0], y[5]);
+    p[5] = _mm256_add_epi64(p[5], _mm256_mul_epu32(x[1], y[4]));
+    p[5] = _mm256_add_epi64(p[5], _mm256_mul_epu32(x[2], y[3]));
+    p[5] = _mm256_add_epi64(p[5], _mm256_mul_epu32(x[3], y[2]));
+    p[5] = _mm256_add_epi64(p[5], _mm256_mul_epu32(x[4], y[1]));
+    p[5] = _mm256_add_epi64(p[5], _mm256_mul_epu32(x[5], y[0]));
+    p[6] = _mm256_mul_epu32(x[0], y[6]);
+    p[6] = _mm256_add_epi64(p[6], _mm256_mul_epu32(x[1], y[5]));
+    p[6] = _mm256_add_epi64(p[6], _mm256_mul_epu32(x[2], y[4]));
+    p[6] = _mm256_add_epi64(p[6], _mm256_mul_epu32(x[3], y[3]));
+    p[6] = _mm256_add_epi64(p[6], _mm256_mul_epu32(x[4], y[2]));
+    p[6] = _mm256_add_epi64(p[6], _mm256_mul_epu32(x[5], y[1]));
+    p[6] = _mm256_add_epi64(p[6], _mm256_mul_epu32(x[6], y[0]));
+    p[7] = _mm256_mul_epu32(x[0], y[7]);
+    p[7] = _mm256_add_epi64(p[7], _mm256_mul_epu32(x[1], y[6]));
+    p[7] = _mm256_add_epi64(p[7], _mm256_mul_epu32(x[2], y[5]));
+    p[7] = _mm256_add_epi64(p[7], _mm256_mul_epu32(x[3], y[4]));
+    p[7] = _mm256_add_epi64(p[7], _mm256_mul_epu32(x[4], y[3]));
+    p[7] = _mm256_add_epi64(p[7], _mm256_mul_epu32(x[5], y[2]));
+    p[7] = _mm256_add_epi64(p[7], _mm256_mul_epu32(x[6], y[1]));
+    p[7] = _mm256_add_epi64(p[7], _mm256_mul_epu32(x[7], y[0]));
+    p[8] = _mm256_mul_epu32(x[0], y[8]);
+    p[8] = _mm256_add_epi64(p[8], _mm256_mul_epu32(x[1], y[7]));
+    p[8] = _mm256_add_epi64(p[8], _mm256_mul_epu32(x[2], y[6]));
+    p[8] = _mm256_add_epi64(p[8], _mm256_mul_epu32(x[3], y[5]));
+    p[8] = _mm256_add_epi64(p[8], _mm256_mul_epu32(x[4], y[4]));
+    p[8] = _mm256_add_epi64(p[8], _mm256_mul_epu32(x[5], y[3]));
+    p[8] = _mm256_add_epi64(p[8], _mm256_mul_epu32(x[6], y[2]));
+    p[8] = _mm256_add_epi64(p[8], _mm256_mul_epu32(x[7], y[1]));
+    p[8] = _mm256_add_epi64(p[8], _mm256_mul_epu32(x[8], y[0]));
+    p[9] = _mm256_mul_epu32(x[0], y[9]);
+    p[9] = _mm256_add_epi64(p[9], _mm256_mul_epu32(x[1], y[8]));
+    p[9] = _mm256_add_epi64(p[9], _mm256_mul_epu32(x[2], y[7]));
+    p[9] = _mm256_add_epi64(p[9], _mm256_mul_epu32(x[3], y[6]));
+    p[9] = _mm256_add_epi64(p[9], _mm256_mul_epu32(x[4], y[5]));
+    p[9] = _mm256_add_epi64(p[9], _mm256_mul_epu32(x[5], y[4]));
+    p[9] = _mm256_add_epi64(p[9], _mm256_mul_epu32(x[6], y[3]));
+    p[9] = _mm256_add_epi64(p[9], _mm256_mul_epu32(x[7], y[2]));
+    p[9] = _mm256_add_epi64(p[9], _mm256_mul_epu32(x[8], y[1]));
+    p[9] = _mm256_add_epi64(p[9], _mm256_mul_epu32(x[9], y[0]));
+    p[10] = _mm256_mul_epu32(x[1], y[9]);
+    p[10] = _mm256_add_epi64(p[10], _mm256_mul_epu32(x[2], y[8]));
+    p[10] = _mm256_add_epi64(p[10], _mm256_mul_epu32(x[3], y[7]));
+    p[10] = _mm256_add_epi64(p[10], _mm256_mul_epu32(x[4], y[6]));
+    p[10] = _mm256_add_epi64(p[10], _mm256_mul_epu32(x[5], y[5]));
+    p[10] = _mm256_add_epi64(p[10], _mm256_mul_epu32(x[6], y[4]));
+    p[10] = _mm256_add_epi64(p[10], _mm256_mul_epu32(x[7], y[3]));
+    p[10] = _mm256_add_epi64(p[10], _mm256_mul_epu32(x[8], y[2]));
+    p[10] = _mm256_add_epi64(p[10], _mm256_mul_epu32(x[9], y[1]));
+    p[11] = _mm256_mul_epu32(x[2], y[9]);
+    p[11] = _mm256_add_epi64(p[11], _mm256_mul_epu32(x[3], y[8]));
+    p[11] = _mm256_add_epi64(p[11], _mm256_mul_epu32(x[4], y[7]));
+    p[11] = _mm256_add_epi64(p[11], _mm256_mul_epu32(x[5], y[6]));
+    p[11] = _mm256_add_epi64(p[11], _mm256_mul_epu32(x[6], y[5]));
+    p[11] = _mm256_add_epi64(p[11], _mm256_mul_epu32(x[7], y[4]));
+    p[11] = _mm256_add_epi64(p[11], _mm256_mul_epu32(x[8], y[3]));
+    p[11] = _mm256_add_epi64(p[11], _mm256_mul_epu32(x[9], y[2]));
+    p[12] = _mm256_mul_epu32(x[3], y[9]);
+    p[12] = _mm256_add_epi64(p[12], _mm256_mul_epu32(x[4], y[8]));
+    p[12] = _mm256_add_epi64(p[12], _mm256_mul_epu32(x[5], y[7]));
+    p[12] = _mm256_add_epi64(p[12], _mm256_mul_epu32(x[6], y[6]));
+    p[12] = _mm256_add_epi64(p[12], _mm256_mul_epu32(x[7], y[5]));
+    p[12] = _mm256_add_epi64(p[12], _mm256_mul_epu32(x[8], y[4]));
+    p[12] = _mm256_add_epi64(p[12], _mm256_mul_epu32(x[9], y[3]));
+    p[13] = _mm256_mul_epu32(x[4], y[9]);
+    p[13] = _mm256_add_epi64(p[13], _mm256_mul_epu32(x[5], y[8]));
+    p[13] = _mm256_add_epi64(p[13], _mm256_mul_epu32(x[6], y[7]));
+    p[13] = _mm256_add_epi64(p[13], _mm256_mul_epu32(x[7], y[6]));
+    p[13] = _mm256_add_epi64(p[13], _mm256_mul_epu32(x[8], y[5]));
+    p[13] = _mm256_add_epi64(p[13], _mm256_mul_epu32(x[9], y[4]));
+    p[14] = _mm256_mul_epu32(x[5], y[9]);
+    p[14] = _mm256_add_epi64(p[14], _mm256_mul_epu32(x[6], y[8]));
+    p[14] = _mm256_add_epi64(p[14], _mm256_mul_epu32(x[7], y[7]));
+    p[14] = _mm256_add_epi64(p[14], _mm256_mul_epu32(x[8], y[6]));
+    p[14] = _mm256_add_epi64(p[14], _mm256_mul_epu32(x[9], y[5]));
+    p[15] = _mm256_mul_epu32(x[6], y[9]);
+    p[15] = _mm256_add_epi64(p[15], _mm256_mul_epu32(x[7], y[8]));
+    p[15] = _mm256_add_epi64(p[15], _mm256_mul_epu32(x[8], y[7]));
+    p[15] = _mm256_add_epi64(p[15], _mm256_mul_epu32(x[9], y[6]));
+    p[16] = _mm256_mul_epu32(x[7], y[9]);
+    p[16] = _mm256_add_epi64(p[16], _mm256_mul_epu32(x[8], y[8]));
+    p[16] = _mm256_add_epi64(p[16], _mm256_mul_epu32(x[9], y[7]));
+    p[17] = _mm256_mul_epu32(x[8], y[9]);
+    p[17] = _mm256_add_epi64(p[17], _mm256_mul_epu32(x[9], y[8]));
+    p[18] = _mm256_mul_epu32(x[9], y[9]);
+
+    rustsecp256k1_v0_8_1_fe_x4_reduce(r, p);
+}
+
+/** Square the elements of a lane by lane, n times. */
+__attribute__((target("avx2")))
+static void rustsecp256k1_v0_8_1_fe_x4_sqr_n(rustsecp256k1_v0_8_1_fe_x4 *r, const rustsecp256k1_v0_8_1_fe_x4 *a, int n) {
+    __m256i x[10], x2[10], p[19];
+    int i, k;
+    *r = *a;
+    for (i = 0; i < n; i++) {
+        for (k = 0; k < 10; k++) {
+            x[k] = r->n[k];
+            x2[k] = _mm256_add_epi64(x[k], x[k]);
+        }
+        p[0] = _mm256_mul_epu32(x[0], x[0]);
+        p[1] = _mm256_mul_epu32(x2[0], x[1]);
+        p[2] = _mm256_mul_epu32(x2[0], x[2]);
+        p[2] = _mm256_add_epi64(p[2], _mm256_mul_epu32(x[1], x[1]));
+        p[3] = _mm256_mul_epu32(x2[0], x[3]);
+        p[3] = _mm256_add_epi64(p[3], _mm256_mul_epu32(x2[1], x[2]));
+        p[4] = _mm256_mul_epu32(x2[0], x[4]);
+        p[4] = _mm256_add_epi64(p[4], _mm256_mul_epu32(x2[1], x[3]));
+        p[4] = _mm256_add_epi64(p[4], _mm256_mul_epu32(x[2], x[2]));
+        p[5] = _mm256_mul_epu32(x2[0], x[5]);
+        p[5] = _mm256_add_epi64(p[5], _mm256_mul_epu32(x2[1], x[4]));
+        p[5] = _mm256_add_epi64(p[5], _mm256_mul_epu32(x2[2], x[3]));
+        p[6] = _mm256_mul_epu32(x2[0], x[6]);
+        p[6] = _mm256_add_epi64(p[6], _mm256_mul_epu32(x2[1], x[5]));
+        p[6] = _mm256_add_epi64(p[6], _mm256_mul_epu32(x2[2], x[4]));
+        p[6] = _mm256_add_epi64(p[6], _mm256_mul_epu32(x[3], x[3]));
+        p[7] = _mm256_mul_epu32(x2[0], x[7]);
+        p[7] = _mm256_add_epi64(p[7], _mm256_mul_epu32(x2[1], x[6]));
+        p[7] = _mm256_add_epi64(p[7], _mm256_mul_epu32(x2[2], x[5]));
+        p[7] = _mm256_add_epi64(p[7], _mm256_mul_epu32(x2[3], x[4]));
+        p[8] = _mm256_mul_epu32(x2[0], x[8]);
+        p[8] = _mm256_add_epi64(p[8], _mm256_mul_epu32(x2[1], x[7]));
+        p[8] = _mm256_add_epi64(p[8], _mm256_mul_epu32(x2[2], x[6]));
+        p[8] = _mm256_add_epi64(p[8], _mm256_mul_epu32(x2[3], x[5]));
+        p[8] = _mm256_add_epi64(p[8], _mm256_mul_epu32(x[4], x[4]));
+        p[9] = _mm256_mul_epu32(x2[0], x[9]);
+        p[9] = _mm256_add_epi64(p[9], _mm256_mul_epu32(x2[1], x[8]));
+        p[9] = _mm256_add_epi64(p[9], _mm256_mul_epu32(x2[2], x[7]));
+        p[9] = _mm256_add_epi64(p[9], _mm256_mul_epu32(x2[3], x[6]));
+        p[9] = _mm256_add_epi64(p[9], _mm256_mul_epu32(x2[4], x[5]));
+        p[10] = _mm256_mul_epu32(x2[1], x[9]);
+        p[10] = _mm256_add_epi64(p[10], _mm256_mul_epu32(x2[2], x[8]));
+        p[10] = _mm256_add_epi64(p[10], _mm256_mul_epu32(x2[3], x[7]));
+        p[10] = _mm256_add_epi64(p[10], _mm256_mul_epu32(x2[4], x[6]));
+        p[10] = _mm256_add_epi64(p[10], _mm256_mul_epu32(x[5], x[5]));
+        p[11] = _mm256_mul_epu32(x2[2], x[9]);
+        p[11] = _mm256_add_epi64(p[11], _mm256_mul_epu32(x2[3], x[8]));
+        p[11] = _mm256_add_epi64(p[11], _mm256_mul_epu32(x2[4], x[7]));
+        p[11] = _mm256_add_epi64(p[11], _mm256_mul_epu32(x2[5], x[6]));
+        p[12] = _mm256_mul_epu32(x2[3], x[9]);
+        p[12] = _mm256_add_epi64(p[12], _mm256_mul_epu32(x2[4], x[8]));
+        p[12] = _mm256_add_epi64(p[12], _mm256_mul_epu32(x2[5], x[7]));
+        p[12] = _mm256_add_epi64(p[12], _mm256_mul_epu32(x[6], x[6]));
+        p[13] = _mm256_mul_epu32(x2[4], x[9]);
+        p[13] = _mm256_add_epi64(p[13], _mm256_mul_epu32(x2[5], x[8]));
+        p[13] = _mm256_add_epi64(p[13], _mm256_mul_epu32(x2[6], x[7]));
+        p[14] = _mm256_mul_epu32(x2[5], x[9]);
+        p[14] = _mm256_add_epi64(p[14], _mm256_mul_epu32(x2[6], x[8]));
+        p[14] = _mm256_add_epi64(p[14], _mm256_mul_epu32(x[7], x[7]));
+        p[15] = _mm256_mul_epu32(x2[6], x[9]);
+        p[15] = _mm256_add_epi64(p[15], _mm256_mul_epu32(x2[7], x[8]));
+        p[16] = _mm256_mul_epu32(x2[7], x[9]);
+        p[16] = _mm256_add_epi64(p[16], _mm256_mul_epu32(x[8], x[8]));
+        p[17] = _mm256_mul_epu32(x2[8], x[9]);
+        p[18] = _mm256_mul_epu32(x[9], x[9]);
+        rustsecp256k1_v0_8_1_fe_x4_reduce(r, p);
+    }
+}
+
+/** Load four field elements into the lanes of r. */
+__attribute__((target("avx2")))
+static void rustsecp256k1_v0_8_1_fe_x4_load(rustsecp256k1_v0_8_1_fe_x4 *r, const rustsecp256k1_v0_8_1_fe *a) {
+    uint64_t limbs[10][4] = {{0}};
+    unsigned char b32[32];
+    int i, k;
+    for (k = 0; k < 4; k++) {
+        rustsecp256k1_v0_8_1_fe t = a[k];
+        rustsecp256k1_v0_8_1_fe_normalize_var(&t);
+        rustsecp256k1_v0_8_1_fe_get_b32(b32, &t);
+        for (i = 0; i < 32; i++) {
+            int bit = 8 * i, shift = bit % 26;
+            uint64_t v = b32[31 - i];
+            limbs[bit / 26][k] |= (v << shift) & 0x3FFFFFF;
+            if (shift > 18) {
+                limbs[bit / 26 + 1][k] |= v >> (26 - shift);
+            }
+        }
+    }
+    for (i = 0; i < 10; i++) {
+        r->n[i] = _mm256_loadu_si256((const __m256i*)limbs[i]);
+    }
+}
+
+/** Store the lanes of a, which have the bounds of fe_mul_inner's output, as four normalized field
+ *  elements. */
+__attribute__((target("avx2")))
+static void rustsecp256k1_v0_8_1_fe_x4_store(rustsecp256k1_v0_8_1_fe *r, const rustsecp256k1_v0_8_1_fe_x4 *a) {
+    static const rustsecp256k1_v0_8_1_fe two_256 = SECP256K1_FE_CONST(0, 0, 0, 0, 0, 0, 1, 0x3D1);
+    uint64_t limbs[10][4], t[10];
+    unsigned char b32[32];
+    int i, k;
+    for (i = 0; i < 10; i++) {
+        _mm256_storeu_si256((__m256i*)limbs[i], a->n[i]);
+    }
+    for (k = 0; k < 4; k++) {
+        uint64_t overflow;
+        for (i = 0; i < 10; i++) {
+            t[i] = limbs[i][k];
+        }
+        for (i = 0; i < 9; i++) {
+            t[i + 1] += t[i] >> 26;
+            t[i] &= 0x3FFFFFF;
+        }
+        /* Bit 256 of the value, which is 2^256 mod p = 0x1000003D1 once folded back. */
+        overflow = t[9] >> 22;
+        t[9] &= 0x3FFFFF;
+        for (i = 0; i < 32; i++) {
+            int bit = 8 * i, shift = bit % 26;
+            uint64_t v = t[bit / 26] >> shift;
+            if (bit / 26 < 9) {
+                v |= t[bit / 26 + 1] << (26 - shift);
+            }
+            b32[31 - i] = v & 0xFF;
+        }
+        /* The value may exceed p, which set_b32 reports but still loads with magnitude 1. */
+        rustsecp256k1_v0_8_1_fe_set_b32(&r[k], b32);
+        if (overflow) {
+            rustsecp256k1_v0_8_1_fe_add(&r[k], &two_256);
+        }
+        rustsecp256k1_v0_8_1_fe_normalize_var(&r[k]);
+    }
+}
+
+/* Computes the (p+1)/4th powers with the addition chain of fe_sqrt in the lanes of AVX2 registers. */
+__attribute__((target("avx2")))
+static void rustsecp256k1_v0_8_1_fe_sqrt_x4(rustsecp256k1_v0_8_1_fe *r, int *ret, const rustsecp256k1_v0_8_1_fe *a) {
+    rustsecp256k1_v0_8_1_fe_x4 x1, x2, x3, x6, x9, x11, x22, x44, x88, x176, x220, x223, t1;
+    rustsecp256k1_v0_8_1_fe t;
+    int k;
+
+    rustsecp256k1_v0_8_1_fe_x4_load(&x1, a);
+
+    rustsecp256k1_v0_8_1_fe_x4_sqr_n(&x2, &x1, 1);
+    rustsecp256k1_v0_8_1_fe_x4_mul(&x2, &x2, &x1);
+
+    rustsecp256k1_v0_8_1_fe_x4_sqr_n(&x3, &x2, 1);
+    rustsecp256k1_v0_8_1_fe_x4_mul(&x3, &x3, &x1);
+
+    rustsecp256k1_v0_8_1_fe_x4_sqr_n(&x6, &x3, 3);
+    rustsecp256k1_v0_8_1_fe_x4_mul(&x6, &x6, &x3);
+
+    rustsecp256k1_v0_8_1_fe_x4_sqr_n(&x9, &x6, 3);
+    rustsecp256k1_v0_8_1_fe_x4_mul(&x9, &x9, &x3);
+
+    rustsecp256k1_v0_8_1_fe_x4_sqr_n(&x11, &x9, 2);
+    rustsecp256k1_v0_8_1_fe_x4_mul(&x11, &x11, &x2);
+
+    rustsecp256k1_v0_8_1_fe_x4_sqr_n(&x22, &x11, 11);
+    rustsecp256k1_v0_8_1_fe_x4_mul(&x22, &x22, &x11);
+
+    rustsecp256k1_v0_8_1_fe_x4_sqr_n(&x44, &x22, 22);
+    rustsecp256k1_v0_8_1_fe_x4_mul(&x44, &x44, &x22);
+
+    rustsecp256k1_v0_8_1_fe_x4_sqr_n(&x88, &x44, 44);
+    rustsecp256k1_v0_8_1_fe_x4_mul(&x88, &x88, &x44);
+
+    rustsecp256k1_v0_8_1_fe_x4_sqr_n(&x176, &x88, 88);
+    rustsecp256k1_v0_8_1_fe_x4_mul(&x176, &x176, &x88);
+
+    rustsecp256k1_v0_8_1_fe_x4_sqr_n(&x220, &x176, 44);
+    rustsecp256k1_v0_8_1_fe_x4_mul(&x220, &x220, &x44);
+
+    rustsecp256k1_v0_8_1_fe_x4_sqr_n(&x223, &x220, 3);
+    rustsecp256k1_v0_8_1_fe_x4_mul(&x223, &x223, &x3);
+
+    rustsecp256k1_v0_8_1_fe_x4_sqr_n(&t1, &x223, 23);
+    rustsecp256k1_v0_8_1_fe_x4_mul(&t1, &t1, &x22);
+    rustsecp256k1_v0_8_1_fe_x4_sqr_n(&t1, &t1, 6);
+    rustsecp256k1_v0_8_1_fe_x4_mul(&t1, &t1, &x2);
+    rustsecp256k1_v0_8_1_fe_x4_sqr_n(&t1, &t1, 2);
+
+    rustsecp256k1_v0_8_1_fe_x4_store(r, &t1);
+    for (k = 0; k < 4; k++) {
+        rustsecp256k1_v0_8_1_fe_sqr(&t, &r[k]);
+        ret[k] = rustsecp256k1_v0_8_1_fe_equal(&t, &a[k]);
+    }
+}
+#endif
+
 #endif /* SECP256K1_FIELD_IMPL_H */
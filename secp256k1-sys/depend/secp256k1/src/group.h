@@ -51,6 +51,13 @@ static void rustsecp256k1_v0_8_1_ge_set_xy(rustsecp256k1_v0_8_1_ge *r, const rus
  *  for Y. Return value indicates whether the result is valid. */
 static int rustsecp256k1_v0_8_1_ge_set_xo_var(rustsecp256k1_v0_8_1_ge *r, const rustsecp256k1_v0_8_1_fe *x, int odd);
 
+#if defined(USE_AVX2_DISPATCH)
+/** Like ge_set_xo_var for four x coordinates at once, taking the square roots with the four-lane
+ *  AVX2 field arithmetic. Sets ret[k] to whether x[k] is on the curve. Must only be called if
+ *  have_avx2() returns 1. */
+static void rustsecp256k1_v0_8_1_ge_set_xo_var_x4(rustsecp256k1_v0_8_1_ge *r, int *ret, const rustsecp256k1_v0_8_1_fe *x, const int *odd);
+#endif
+
 /** Check whether a group element is the point at infinity. */
 static int rustsecp256k1_v0_8_1_ge_is_infinity(const rustsecp256k1_v0_8_1_ge *a);
 
@@ -69,6 +76,10 @@ static void rustsecp256k1_v0_8_1_ge_set_gej_var(rustsecp256k1_v0_8_1_ge *r, rust
 /** Set a batch of group elements equal to the inputs given in jacobian coordinates */
 static void rustsecp256k1_v0_8_1_ge_set_all_gej_var(rustsecp256k1_v0_8_1_ge *r, const rustsecp256k1_v0_8_1_gej *a, size_t len);
 
+/** Set a batch of group elements equal to the inputs given in jacobian coordinates, none of which
+ *  may be infinity. Constant time. */
+static void rustsecp256k1_v0_8_1_ge_set_all_gej(rustsecp256k1_v0_8_1_ge *r, const rustsecp256k1_v0_8_1_gej *a, size_t len);
+
 /** Bring a batch of inputs to the same global z "denominator", based on ratios between
  *  (omitted) z coordinates of adjacent elements.
  *
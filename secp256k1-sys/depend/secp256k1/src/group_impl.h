@@ -161,6 +161,31 @@ static void rustsecp256k1_v0_8_1_ge_set_all_gej_var(rustsecp256k1_v0_8_1_ge *r,
     }
 }
 
+static void rustsecp256k1_v0_8_1_ge_set_all_gej(rustsecp256k1_v0_8_1_ge *r, const rustsecp256k1_v0_8_1_gej *a, size_t len) {
+    rustsecp256k1_v0_8_1_fe u;
+    size_t i;
+
+    if (len == 0) {
+        return;
+    }
+    /* Use destination's x coordinates as scratch space for the prefix products of the z's */
+    r[0].x = a[0].z;
+    for (i = 1; i < len; i++) {
+        rustsecp256k1_v0_8_1_fe_mul(&r[i].x, &r[i - 1].x, &a[i].z);
+    }
+    rustsecp256k1_v0_8_1_fe_inv(&u, &r[len - 1].x);
+
+    for (i = len - 1; i > 0; i--) {
+        rustsecp256k1_v0_8_1_fe_mul(&r[i].x, &r[i - 1].x, &u);
+        rustsecp256k1_v0_8_1_fe_mul(&u, &u, &a[i].z);
+    }
+    r[0].x = u;
+
+    for (i = 0; i < len; i++) {
+        rustsecp256k1_v0_8_1_ge_set_gej_zinv(&r[i], &a[i], &r[i].x);
+    }
+}
+
 static void rustsecp256k1_v0_8_1_ge_table_set_globalz(size_t len, rustsecp256k1_v0_8_1_ge *a, const rustsecp256k1_v0_8_1_fe *zr) {
     size_t i = len - 1;
     rustsecp256k1_v0_8_1_fe zs;
@@ -229,6 +254,28 @@ static int rustsecp256k1_v0_8_1_ge_set_xo_var(rustsecp256k1_v0_8_1_ge *r, const
 
 }
 
+#if defined(USE_AVX2_DISPATCH)
+static void rustsecp256k1_v0_8_1_ge_set_xo_var_x4(rustsecp256k1_v0_8_1_ge *r, int *ret, const rustsecp256k1_v0_8_1_fe *x, const int *odd) {
+    rustsecp256k1_v0_8_1_fe c[4], y[4];
+    int k;
+    for (k = 0; k < 4; k++) {
+        rustsecp256k1_v0_8_1_fe x2;
+        rustsecp256k1_v0_8_1_fe_sqr(&x2, &x[k]);
+        rustsecp256k1_v0_8_1_fe_mul(&c[k], &x[k], &x2);
+        rustsecp256k1_v0_8_1_fe_add(&c[k], &rustsecp256k1_v0_8_1_fe_const_b);
+    }
+    rustsecp256k1_v0_8_1_fe_sqrt_x4(y, ret, c);
+    for (k = 0; k < 4; k++) {
+        r[k].x = x[k];
+        r[k].y = y[k];
+        r[k].infinity = 0;
+        if (rustsecp256k1_v0_8_1_fe_is_odd(&r[k].y) != odd[k]) {
+            rustsecp256k1_v0_8_1_fe_negate(&r[k].y, &r[k].y, 1);
+        }
+    }
+}
+#endif
+
 static void rustsecp256k1_v0_8_1_gej_set_ge(rustsecp256k1_v0_8_1_gej *r, const rustsecp256k1_v0_8_1_ge *a) {
    r->infinity = a->infinity;
    r->x = a->x;
@@ -20,6 +20,12 @@ static void rustsecp256k1_v0_8_1_sha256_initialize(rustsecp256k1_v0_8_1_sha256 *
 static void rustsecp256k1_v0_8_1_sha256_write(rustsecp256k1_v0_8_1_sha256 *hash, const unsigned char *data, size_t size);
 static void rustsecp256k1_v0_8_1_sha256_finalize(rustsecp256k1_v0_8_1_sha256 *hash, unsigned char *out32);
 
+/* Multi-buffer versions of sha256_write and sha256_finalize, hashing eight messages at once. The
+ * eight hashes must have been fed the same number of bytes. data points to the eight inputs of
+ * len bytes, and out32 to 8 * 32 bytes of output. */
+static void rustsecp256k1_v0_8_1_sha256_write_x8(rustsecp256k1_v0_8_1_sha256 *hash, const unsigned char *const *data, size_t len);
+static void rustsecp256k1_v0_8_1_sha256_finalize_x8(rustsecp256k1_v0_8_1_sha256 *hash, unsigned char *out32);
+
 typedef struct {
     rustsecp256k1_v0_8_1_sha256 inner, outer;
 } rustsecp256k1_v0_8_1_hmac_sha256;
@@ -35,6 +41,11 @@ typedef struct {
 } rustsecp256k1_v0_8_1_rfc6979_hmac_sha256;
 
 static void rustsecp256k1_v0_8_1_rfc6979_hmac_sha256_initialize(rustsecp256k1_v0_8_1_rfc6979_hmac_sha256 *rng, const unsigned char *key, size_t keylen);
+/* Split initialization for keys sharing a prefix: initialize_prefix hashes the first prefixlen bytes
+ * of the key, initialize_from(rng, prefix, key, keylen, prefixlen) then completes the
+ * initialization for the whole key. */
+static void rustsecp256k1_v0_8_1_rfc6979_hmac_sha256_initialize_prefix(rustsecp256k1_v0_8_1_hmac_sha256 *prefix, const unsigned char *key, size_t prefixlen);
+static void rustsecp256k1_v0_8_1_rfc6979_hmac_sha256_initialize_from(rustsecp256k1_v0_8_1_rfc6979_hmac_sha256 *rng, const rustsecp256k1_v0_8_1_hmac_sha256 *prefix, const unsigned char *key, size_t keylen, size_t prefixlen);
 static void rustsecp256k1_v0_8_1_rfc6979_hmac_sha256_generate(rustsecp256k1_v0_8_1_rfc6979_hmac_sha256 *rng, unsigned char *out, size_t outlen);
 static void rustsecp256k1_v0_8_1_rfc6979_hmac_sha256_finalize(rustsecp256k1_v0_8_1_rfc6979_hmac_sha256 *rng);
 
@@ -14,6 +14,10 @@
 #include <stdint.h>
 #include <string.h>
 
+#if defined(USE_SHA_NI_DISPATCH) || defined(USE_AVX2_DISPATCH)
+#include <immintrin.h>
+#endif
+
 #define Ch(x,y,z) ((z) ^ ((x) & ((y) ^ (z))))
 #define Maj(x,y,z) (((x) & (y)) | ((z) & ((x) | (y))))
 #define Sigma0(x) (((x) >> 2 | (x) << 30) ^ ((x) >> 13 | (x) << 19) ^ ((x) >> 22 | (x) << 10))
@@ -41,7 +45,7 @@ static void rustsecp256k1_v0_8_1_sha256_initialize(rustsecp256k1_v0_8_1_sha256 *
 }
 
 /** Perform one SHA-256 transformation, processing 16 big endian 32-bit words. */
-static void rustsecp256k1_v0_8_1_sha256_transform(uint32_t* s, const unsigned char* buf) {
+static void rustsecp256k1_v0_8_1_sha256_transform_portable(uint32_t* s, const unsigned char* buf) {
     uint32_t a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
     uint32_t w0, w1, w2, w3, w4, w5, w6, w7, w8, w9, w10, w11, w12, w13, w14, w15;
 
@@ -123,6 +127,176 @@ static void rustsecp256k1_v0_8_1_sha256_transform(uint32_t* s, const unsigned ch
     s[7] += h;
 }
 
+#if defined(USE_SHA_NI_DISPATCH) || defined(USE_AVX2_DISPATCH)
+static const uint32_t rustsecp256k1_v0_8_1_sha256_k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+#endif
+
+#if defined(USE_SHA_NI_DISPATCH)
+/* Four rounds with the message words m and the round constants 4*i..4*i+3, on the state in
+ * the ABEF/CDGH layout of sha256rnds2. */
+#define ShaNiRounds4(abef, cdgh, m, i) do { \
+    __m128i t_ = _mm_add_epi32((m), _mm_loadu_si128((const __m128i*)&rustsecp256k1_v0_8_1_sha256_k[4 * (i)])); \
+    (cdgh) = _mm_sha256rnds2_epu32((cdgh), (abef), t_); \
+    (abef) = _mm_sha256rnds2_epu32((abef), (cdgh), _mm_shuffle_epi32(t_, 0x0E)); \
+} while(0)
+
+/* Replaces the message words m0 by the four words following m3. */
+#define ShaNiSchedule(m0, m1, m2, m3) do { \
+    (m0) = _mm_add_epi32(_mm_sha256msg1_epu32((m0), (m1)), _mm_alignr_epi8((m3), (m2), 4)); \
+    (m0) = _mm_sha256msg2_epu32((m0), (m3)); \
+} while(0)
+
+/** Perform one SHA-256 transformation with the x86 SHA extensions. */
+__attribute__((target("sha,sse4.1")))
+static void rustsecp256k1_v0_8_1_sha256_transform_shani(uint32_t* s, const unsigned char* buf) {
+    const __m128i bswap = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+    __m128i abef, cdgh, abef_save, cdgh_save, m0, m1, m2, m3, t;
+
+    /* Bring the state from ABCD/EFGH into ABEF/CDGH form. */
+    t = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&s[0]), 0xB1);
+    cdgh = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&s[4]), 0x1B);
+    abef = _mm_alignr_epi8(t, cdgh, 8);
+    cdgh = _mm_blend_epi16(cdgh, t, 0xF0);
+    abef_save = abef;
+    cdgh_save = cdgh;
+
+    m0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)&buf[0]), bswap);
+    m1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)&buf[16]), bswap);
+    m2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)&buf[32]), bswap);
+    m3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)&buf[48]), bswap);
+
+    ShaNiRounds4(abef, cdgh, m0, 0);
+    ShaNiRounds4(abef, cdgh, m1, 1);
+    ShaNiRounds4(abef, cdgh, m2, 2);
+    ShaNiRounds4(abef, cdgh, m3, 3);
+    ShaNiSchedule(m0, m1, m2, m3); ShaNiRounds4(abef, cdgh, m0, 4);
+    ShaNiSchedule(m1, m2, m3, m0); ShaNiRounds4(abef, cdgh, m1, 5);
+    ShaNiSchedule(m2, m3, m0, m1); ShaNiRounds4(abef, cdgh, m2, 6);
+    ShaNiSchedule(m3, m0, m1, m2); ShaNiRounds4(abef, cdgh, m3, 7);
+    ShaNiSchedule(m0, m1, m2, m3); ShaNiRounds4(abef, cdgh, m0, 8);
+    ShaNiSchedule(m1, m2, m3, m0); ShaNiRounds4(abef, cdgh, m1, 9);
+    ShaNiSchedule(m2, m3, m0, m1); ShaNiRounds4(abef, cdgh, m2, 10);
+    ShaNiSchedule(m3, m0, m1, m2); ShaNiRounds4(abef, cdgh, m3, 11);
+    ShaNiSchedule(m0, m1, m2, m3); ShaNiRounds4(abef, cdgh, m0, 12);
+    ShaNiSchedule(m1, m2, m3, m0); ShaNiRounds4(abef, cdgh, m1, 13);
+    ShaNiSchedule(m2, m3, m0, m1); ShaNiRounds4(abef, cdgh, m2, 14);
+    ShaNiSchedule(m3, m0, m1, m2); ShaNiRounds4(abef, cdgh, m3, 15);
+
+    abef = _mm_add_epi32(abef, abef_save);
+    cdgh = _mm_add_epi32(cdgh, cdgh_save);
+
+    /* And back into ABCD/EFGH form. */
+    t = _mm_shuffle_epi32(abef, 0x1B);
+    cdgh = _mm_shuffle_epi32(cdgh, 0xB1);
+    _mm_storeu_si128((__m128i*)&s[0], _mm_blend_epi16(t, cdgh, 0xF0));
+    _mm_storeu_si128((__m128i*)&s[4], _mm_alignr_epi8(cdgh, t, 8));
+}
+
+#undef ShaNiSchedule
+#undef ShaNiRounds4
+#endif
+
+#if defined(USE_AVX2_DISPATCH)
+#define Ror8(x,n) _mm256_or_si256(_mm256_srli_epi32((x), (n)), _mm256_slli_epi32((x), 32 - (n)))
+#define Xor8(x,y,z) _mm256_xor_si256(_mm256_xor_si256((x), (y)), (z))
+#define Ch8(x,y,z) _mm256_xor_si256((z), _mm256_and_si256((x), _mm256_xor_si256((y), (z))))
+#define Maj8(x,y,z) _mm256_or_si256(_mm256_and_si256((x), (y)), _mm256_and_si256((z), _mm256_or_si256((x), (y))))
+#define Sigma08(x) Xor8(Ror8((x), 2), Ror8((x), 13), Ror8((x), 22))
+#define Sigma18(x) Xor8(Ror8((x), 6), Ror8((x), 11), Ror8((x), 25))
+#define sigma08(x) Xor8(Ror8((x), 7), Ror8((x), 18), _mm256_srli_epi32((x), 3))
+#define sigma18(x) Xor8(Ror8((x), 17), Ror8((x), 19), _mm256_srli_epi32((x), 10))
+
+/* Round i of all eight hashes, extending the message schedule in w as it goes. */
+#define Round8(a,b,c,d,e,f,g,h,i) do { \
+    __m256i t1, t2; \
+    if ((i) >= 16) { \
+        w[(i) & 15] = _mm256_add_epi32(_mm256_add_epi32(w[(i) & 15], sigma18(w[((i) - 2) & 15])), \
+                                       _mm256_add_epi32(w[((i) - 7) & 15], sigma08(w[((i) - 15) & 15]))); \
+    } \
+    t1 = _mm256_add_epi32(_mm256_add_epi32((h), Sigma18(e)), _mm256_add_epi32(Ch8((e), (f), (g)), w[(i) & 15])); \
+    t1 = _mm256_add_epi32(t1, _mm256_set1_epi32((int)rustsecp256k1_v0_8_1_sha256_k[i])); \
+    t2 = _mm256_add_epi32(Sigma08(a), Maj8((a), (b), (c))); \
+    (d) = _mm256_add_epi32((d), t1); \
+    (h) = _mm256_add_epi32(t1, t2); \
+} while(0)
+
+/** Perform one SHA-256 transformation of each of eight hashes, with their buffered blocks, in the
+ *  eight 32-bit lanes of AVX2 registers. */
+__attribute__((target("avx2")))
+static void rustsecp256k1_v0_8_1_sha256_transform_x8_avx2(rustsecp256k1_v0_8_1_sha256 *hash) {
+    __m256i s[8], w[16];
+    __m256i a, b, c, d, e, f, g, h;
+    uint32_t lanes[8];
+    int i, k;
+
+    /* Transpose the states and the big endian message words into lanes. */
+    for (i = 0; i < 8; i++) {
+        for (k = 0; k < 8; k++) {
+            lanes[k] = hash[k].s[i];
+        }
+        s[i] = _mm256_loadu_si256((const __m256i*)lanes);
+    }
+    for (i = 0; i < 16; i++) {
+        for (k = 0; k < 8; k++) {
+            lanes[k] = rustsecp256k1_v0_8_1_read_be32(&hash[k].buf[4 * i]);
+        }
+        w[i] = _mm256_loadu_si256((const __m256i*)lanes);
+    }
+
+    a = s[0]; b = s[1]; c = s[2]; d = s[3]; e = s[4]; f = s[5]; g = s[6]; h = s[7];
+    for (i = 0; i < 64; i += 8) {
+        Round8(a, b, c, d, e, f, g, h, i + 0);
+        Round8(h, a, b, c, d, e, f, g, i + 1);
+        Round8(g, h, a, b, c, d, e, f, i + 2);
+        Round8(f, g, h, a, b, c, d, e, i + 3);
+        Round8(e, f, g, h, a, b, c, d, i + 4);
+        Round8(d, e, f, g, h, a, b, c, i + 5);
+        Round8(c, d, e, f, g, h, a, b, i + 6);
+        Round8(b, c, d, e, f, g, h, a, i + 7);
+    }
+    s[0] = _mm256_add_epi32(s[0], a); s[1] = _mm256_add_epi32(s[1], b);
+    s[2] = _mm256_add_epi32(s[2], c); s[3] = _mm256_add_epi32(s[3], d);
+    s[4] = _mm256_add_epi32(s[4], e); s[5] = _mm256_add_epi32(s[5], f);
+    s[6] = _mm256_add_epi32(s[6], g); s[7] = _mm256_add_epi32(s[7], h);
+
+    for (i = 0; i < 8; i++) {
+        _mm256_storeu_si256((__m256i*)lanes, s[i]);
+        for (k = 0; k < 8; k++) {
+            hash[k].s[i] = lanes[k];
+        }
+    }
+}
+
+#undef Round8
+#undef sigma18
+#undef sigma08
+#undef Sigma18
+#undef Sigma08
+#undef Maj8
+#undef Ch8
+#undef Xor8
+#undef Ror8
+#endif
+
+static void rustsecp256k1_v0_8_1_sha256_transform(uint32_t* s, const unsigned char* buf) {
+#if defined(USE_SHA_NI_DISPATCH)
+    if (rustsecp256k1_v0_8_1_have_sha_ni()) {
+        rustsecp256k1_v0_8_1_sha256_transform_shani(s, buf);
+        return;
+    }
+#endif
+    rustsecp256k1_v0_8_1_sha256_transform_portable(s, buf);
+}
+
 static void rustsecp256k1_v0_8_1_sha256_write(rustsecp256k1_v0_8_1_sha256 *hash, const unsigned char *data, size_t len) {
     size_t bufsize = hash->bytes & 0x3F;
     hash->bytes += len;
@@ -142,6 +316,78 @@ static void rustsecp256k1_v0_8_1_sha256_write(rustsecp256k1_v0_8_1_sha256 *hash,
     }
 }
 
+/* Perform one SHA-256 transformation of each of eight hashes with its buffered block. */
+static void rustsecp256k1_v0_8_1_sha256_transform_x8(rustsecp256k1_v0_8_1_sha256 *hash) {
+    int k;
+#if defined(USE_AVX2_DISPATCH)
+    int avx2 = rustsecp256k1_v0_8_1_have_avx2();
+#if defined(USE_SHA_NI_DISPATCH)
+    /* One hash at a time with the SHA extensions is about twice as fast as eight in AVX2 lanes
+     * (hash_sha256_transform_x8 and hash_sha256_transform_x8_avx2 in bench_internal). */
+    avx2 = avx2 && !rustsecp256k1_v0_8_1_have_sha_ni();
+#endif
+    if (avx2) {
+        rustsecp256k1_v0_8_1_sha256_transform_x8_avx2(hash);
+        return;
+    }
+#endif
+    for (k = 0; k < 8; k++) {
+        rustsecp256k1_v0_8_1_sha256_transform(hash[k].s, hash[k].buf);
+    }
+}
+
+static void rustsecp256k1_v0_8_1_sha256_write_x8(rustsecp256k1_v0_8_1_sha256 *hash, const unsigned char *const *data, size_t len) {
+    size_t bufsize = hash[0].bytes & 0x3F;
+    size_t pos = 0;
+    int k;
+    for (k = 7; k >= 0; k--) {
+        VERIFY_CHECK(hash[k].bytes == hash[0].bytes);
+        hash[k].bytes += len;
+    }
+    VERIFY_CHECK(hash[0].bytes >= len);
+    while (len - pos >= 64 - bufsize) {
+        /* Fill the buffers, and process them. */
+        size_t chunk_len = 64 - bufsize;
+        for (k = 0; k < 8; k++) {
+            memcpy(hash[k].buf + bufsize, data[k] + pos, chunk_len);
+        }
+        pos += chunk_len;
+        rustsecp256k1_v0_8_1_sha256_transform_x8(hash);
+        bufsize = 0;
+    }
+    if (len > pos) {
+        /* Fill the buffers with what remains. */
+        for (k = 0; k < 8; k++) {
+            memcpy(hash[k].buf + bufsize, data[k] + pos, len - pos);
+        }
+    }
+}
+
+static void rustsecp256k1_v0_8_1_sha256_finalize_x8(rustsecp256k1_v0_8_1_sha256 *hash, unsigned char *out32) {
+    static const unsigned char pad[64] = {0x80};
+    const unsigned char *data[8];
+    unsigned char sizedesc[8];
+    int i, k;
+    /* The maximum message size of SHA256 is 2^64-1 bits. */
+    VERIFY_CHECK(hash[0].bytes < ((uint64_t)1 << 61));
+    rustsecp256k1_v0_8_1_write_be32(&sizedesc[0], hash[0].bytes >> 29);
+    rustsecp256k1_v0_8_1_write_be32(&sizedesc[4], hash[0].bytes << 3);
+    for (k = 0; k < 8; k++) {
+        data[k] = pad;
+    }
+    rustsecp256k1_v0_8_1_sha256_write_x8(hash, data, 1 + ((119 - (hash[0].bytes % 64)) % 64));
+    for (k = 0; k < 8; k++) {
+        data[k] = sizedesc;
+    }
+    rustsecp256k1_v0_8_1_sha256_write_x8(hash, data, 8);
+    for (k = 0; k < 8; k++) {
+        for (i = 0; i < 8; i++) {
+            rustsecp256k1_v0_8_1_write_be32(&out32[32 * k + 4 * i], hash[k].s[i]);
+            hash[k].s[i] = 0;
+        }
+    }
+}
+
 static void rustsecp256k1_v0_8_1_sha256_finalize(rustsecp256k1_v0_8_1_sha256 *hash, unsigned char *out32) {
     static const unsigned char pad[64] = {0x80};
     unsigned char sizedesc[8];
@@ -212,19 +458,36 @@ static void rustsecp256k1_v0_8_1_hmac_sha256_finalize(rustsecp256k1_v0_8_1_hmac_
 }
 
 
-static void rustsecp256k1_v0_8_1_rfc6979_hmac_sha256_initialize(rustsecp256k1_v0_8_1_rfc6979_hmac_sha256 *rng, const unsigned char *key, size_t keylen) {
-    rustsecp256k1_v0_8_1_hmac_sha256 hmac;
+static void rustsecp256k1_v0_8_1_rfc6979_hmac_sha256_initialize_prefix(rustsecp256k1_v0_8_1_hmac_sha256 *prefix, const unsigned char *key, size_t prefixlen) {
     static const unsigned char zero[1] = {0x00};
+    unsigned char v[32];
+    unsigned char k[32];
+
+    memset(v, 0x01, 32); /* RFC6979 3.2.b. */
+    memset(k, 0x00, 32); /* RFC6979 3.2.c. */
+
+    /* The part of RFC6979 3.2.d. that only depends on the prefix of the key. */
+    rustsecp256k1_v0_8_1_hmac_sha256_initialize(prefix, k, 32);
+    rustsecp256k1_v0_8_1_hmac_sha256_write(prefix, v, 32);
+    rustsecp256k1_v0_8_1_hmac_sha256_write(prefix, zero, 1);
+    rustsecp256k1_v0_8_1_hmac_sha256_write(prefix, key, prefixlen);
+}
+
+static void rustsecp256k1_v0_8_1_rfc6979_hmac_sha256_initialize(rustsecp256k1_v0_8_1_rfc6979_hmac_sha256 *rng, const unsigned char *key, size_t keylen) {
+    rustsecp256k1_v0_8_1_hmac_sha256 prefix;
+    rustsecp256k1_v0_8_1_rfc6979_hmac_sha256_initialize_prefix(&prefix, key, keylen);
+    rustsecp256k1_v0_8_1_rfc6979_hmac_sha256_initialize_from(rng, &prefix, key, keylen, keylen);
+}
+
+static void rustsecp256k1_v0_8_1_rfc6979_hmac_sha256_initialize_from(rustsecp256k1_v0_8_1_rfc6979_hmac_sha256 *rng, const rustsecp256k1_v0_8_1_hmac_sha256 *prefix, const unsigned char *key, size_t keylen, size_t prefixlen) {
+    rustsecp256k1_v0_8_1_hmac_sha256 hmac = *prefix;
     static const unsigned char one[1] = {0x01};
 
+    VERIFY_CHECK(prefixlen <= keylen);
     memset(rng->v, 0x01, 32); /* RFC6979 3.2.b. */
-    memset(rng->k, 0x00, 32); /* RFC6979 3.2.c. */
 
     /* RFC6979 3.2.d. */
-    rustsecp256k1_v0_8_1_hmac_sha256_initialize(&hmac, rng->k, 32);
-    rustsecp256k1_v0_8_1_hmac_sha256_write(&hmac, rng->v, 32);
-    rustsecp256k1_v0_8_1_hmac_sha256_write(&hmac, zero, 1);
-    rustsecp256k1_v0_8_1_hmac_sha256_write(&hmac, key, keylen);
+    rustsecp256k1_v0_8_1_hmac_sha256_write(&hmac, key + prefixlen, keylen - prefixlen);
     rustsecp256k1_v0_8_1_hmac_sha256_finalize(&hmac, rng->k);
     rustsecp256k1_v0_8_1_hmac_sha256_initialize(&hmac, rng->k, 32);
     rustsecp256k1_v0_8_1_hmac_sha256_write(&hmac, rng->v, 32);
@@ -68,4 +68,64 @@ int rustsecp256k1_v0_8_1_ecdh(const rustsecp256k1_v0_8_1_context* ctx, unsigned
     return !!ret & !overflow;
 }
 
+/* Number of shared points sharing one field inversion in ecdh_many. */
+#define ECDH_MANY_CHUNK 64
+
+int rustsecp256k1_v0_8_1_ecdh_many(const rustsecp256k1_v0_8_1_context* ctx, unsigned char *output, size_t outputlen, const rustsecp256k1_v0_8_1_pubkey *points, size_t n_points, const unsigned char *scalar, rustsecp256k1_v0_8_1_ecdh_hash_function hashfp, void *data) {
+    int ret = 1;
+    int overflow = 0;
+    rustsecp256k1_v0_8_1_gej res[ECDH_MANY_CHUNK];
+    rustsecp256k1_v0_8_1_ge pt[ECDH_MANY_CHUNK];
+    rustsecp256k1_v0_8_1_scalar s;
+    rustsecp256k1_v0_8_1_ecmult_const_recoding rec;
+    unsigned char x[32];
+    unsigned char y[32];
+    size_t offset;
+    size_t i;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(n_points == 0 || output != NULL);
+    ARG_CHECK(n_points == 0 || points != NULL);
+    ARG_CHECK(scalar != NULL);
+
+    if (hashfp == NULL) {
+        hashfp = rustsecp256k1_v0_8_1_ecdh_hash_function_default;
+    }
+
+    rustsecp256k1_v0_8_1_scalar_set_b32(&s, scalar, &overflow);
+
+    overflow |= rustsecp256k1_v0_8_1_scalar_is_zero(&s);
+    rustsecp256k1_v0_8_1_scalar_cmov(&s, &rustsecp256k1_v0_8_1_scalar_one, overflow);
+
+    /* The recoding of the scalar is shared by all points. */
+    rustsecp256k1_v0_8_1_ecmult_const_recode(&rec, &s, 256);
+
+    for (offset = 0; offset < n_points; offset += ECDH_MANY_CHUNK) {
+        size_t len = n_points - offset < ECDH_MANY_CHUNK ? n_points - offset : ECDH_MANY_CHUNK;
+        for (i = 0; i < len; i++) {
+            rustsecp256k1_v0_8_1_pubkey_load(ctx, &pt[i], &points[offset + i]);
+            rustsecp256k1_v0_8_1_ecmult_const_recoded(&res[i], &pt[i], &rec);
+        }
+        rustsecp256k1_v0_8_1_ge_set_all_gej(pt, res, len);
+
+        /* Compute a hash of each point */
+        for (i = 0; i < len; i++) {
+            rustsecp256k1_v0_8_1_fe_normalize(&pt[i].x);
+            rustsecp256k1_v0_8_1_fe_normalize(&pt[i].y);
+            rustsecp256k1_v0_8_1_fe_get_b32(x, &pt[i].x);
+            rustsecp256k1_v0_8_1_fe_get_b32(y, &pt[i].y);
+
+            ret &= !!hashfp(output + (offset + i) * outputlen, x, y, data);
+        }
+    }
+
+    memset(x, 0, 32);
+    memset(y, 0, 32);
+    memset(pt, 0, sizeof(pt));
+    memset(&rec, 0, sizeof(rec));
+    rustsecp256k1_v0_8_1_scalar_clear(&s);
+
+    return ret & !overflow;
+}
+
 #endif /* SECP256K1_MODULE_ECDH_MAIN_H */
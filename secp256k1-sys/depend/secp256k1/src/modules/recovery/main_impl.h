@@ -84,19 +84,12 @@ int rustsecp256k1_v0_8_1_ecdsa_recoverable_signature_convert(const rustsecp256k1
     return 1;
 }
 
-static int rustsecp256k1_v0_8_1_ecdsa_sig_recover(const rustsecp256k1_v0_8_1_scalar *sigr, const rustsecp256k1_v0_8_1_scalar* sigs, rustsecp256k1_v0_8_1_ge *pubkey, const rustsecp256k1_v0_8_1_scalar *message, int recid) {
+/* Computes the R point of a signature from its r value and recovery id. */
+static int rustsecp256k1_v0_8_1_ecdsa_sig_recover_r(rustsecp256k1_v0_8_1_ge *x, const rustsecp256k1_v0_8_1_scalar *sigr, int recid) {
     unsigned char brx[32];
     rustsecp256k1_v0_8_1_fe fx;
-    rustsecp256k1_v0_8_1_ge x;
-    rustsecp256k1_v0_8_1_gej xj;
-    rustsecp256k1_v0_8_1_scalar rn, u1, u2;
-    rustsecp256k1_v0_8_1_gej qj;
     int r;
 
-    if (rustsecp256k1_v0_8_1_scalar_is_zero(sigr) || rustsecp256k1_v0_8_1_scalar_is_zero(sigs)) {
-        return 0;
-    }
-
     rustsecp256k1_v0_8_1_scalar_get_b32(brx, sigr);
     r = rustsecp256k1_v0_8_1_fe_set_b32(&fx, brx);
     (void)r;
@@ -107,7 +100,20 @@ static int rustsecp256k1_v0_8_1_ecdsa_sig_recover(const rustsecp256k1_v0_8_1_sca
         }
         rustsecp256k1_v0_8_1_fe_add(&fx, &rustsecp256k1_v0_8_1_ecdsa_const_order_as_fe);
     }
-    if (!rustsecp256k1_v0_8_1_ge_set_xo_var(&x, &fx, recid & 1)) {
+    return rustsecp256k1_v0_8_1_ge_set_xo_var(x, &fx, recid & 1);
+}
+
+static int rustsecp256k1_v0_8_1_ecdsa_sig_recover(const rustsecp256k1_v0_8_1_scalar *sigr, const rustsecp256k1_v0_8_1_scalar* sigs, rustsecp256k1_v0_8_1_ge *pubkey, const rustsecp256k1_v0_8_1_scalar *message, int recid) {
+    rustsecp256k1_v0_8_1_ge x;
+    rustsecp256k1_v0_8_1_gej xj;
+    rustsecp256k1_v0_8_1_scalar rn, u1, u2;
+    rustsecp256k1_v0_8_1_gej qj;
+
+    if (rustsecp256k1_v0_8_1_scalar_is_zero(sigr) || rustsecp256k1_v0_8_1_scalar_is_zero(sigs)) {
+        return 0;
+    }
+
+    if (!rustsecp256k1_v0_8_1_ecdsa_sig_recover_r(&x, sigr, recid)) {
         return 0;
     }
     rustsecp256k1_v0_8_1_gej_set_ge(&xj, &x);
@@ -156,4 +162,217 @@ int rustsecp256k1_v0_8_1_ecdsa_recover(const rustsecp256k1_v0_8_1_context* ctx,
     }
 }
 
+/* Number of signatures sharing one scalar and one field inversion in ecdsa_recover_batch. */
+#define ECDSA_RECOVER_BATCH_CHUNK 64
+
+int rustsecp256k1_v0_8_1_ecdsa_recover_batch(const rustsecp256k1_v0_8_1_context* ctx, rustsecp256k1_v0_8_1_pubkey *pubkeys, const rustsecp256k1_v0_8_1_ecdsa_recoverable_signature *const *sigs, const unsigned char *const *msghash32, size_t n) {
+    rustsecp256k1_v0_8_1_scalar r[ECDSA_RECOVER_BATCH_CHUNK];
+    rustsecp256k1_v0_8_1_scalar rn[ECDSA_RECOVER_BATCH_CHUNK];
+    rustsecp256k1_v0_8_1_gej qj[ECDSA_RECOVER_BATCH_CHUNK];
+    rustsecp256k1_v0_8_1_ge q[ECDSA_RECOVER_BATCH_CHUNK];
+    int valid[ECDSA_RECOVER_BATCH_CHUNK];
+    rustsecp256k1_v0_8_1_scalar s, m, u1, u2;
+    rustsecp256k1_v0_8_1_ge x;
+    rustsecp256k1_v0_8_1_gej xj;
+    int recid;
+    size_t offset;
+    size_t i;
+    int ret = 1;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(n == 0 || pubkeys != NULL);
+    if (n > 0) {
+        memset(pubkeys, 0, sizeof(*pubkeys) * n);
+    }
+    ARG_CHECK(n == 0 || sigs != NULL);
+    ARG_CHECK(n == 0 || msghash32 != NULL);
+    for (i = 0; i < n; i++) {
+        ARG_CHECK(sigs[i] != NULL);
+        ARG_CHECK(msghash32[i] != NULL);
+    }
+
+    for (offset = 0; offset < n; offset += ECDSA_RECOVER_BATCH_CHUNK) {
+        size_t len = n - offset < ECDSA_RECOVER_BATCH_CHUNK ? n - offset : ECDSA_RECOVER_BATCH_CHUNK;
+
+        /* Invert all r values of the chunk at once, with 1 standing in for those of invalid signatures. */
+        for (i = 0; i < len; i++) {
+            rustsecp256k1_v0_8_1_ecdsa_recoverable_signature_load(ctx, &r[i], &s, &recid, sigs[offset + i]);
+            VERIFY_CHECK(recid >= 0 && recid < 4);  /* should have been caught in parse_compact */
+            valid[i] = !rustsecp256k1_v0_8_1_scalar_is_zero(&r[i]) && !rustsecp256k1_v0_8_1_scalar_is_zero(&s);
+            if (!valid[i]) {
+                rustsecp256k1_v0_8_1_scalar_set_int(&r[i], 1);
+            }
+        }
+        rustsecp256k1_v0_8_1_scalar_inverse_all_var(rn, r, len);
+
+        /* Same as ecdsa_sig_recover, leaving the results in Jacobian coordinates. */
+        for (i = 0; i < len; i++) {
+            rustsecp256k1_v0_8_1_gej_set_infinity(&qj[i]);
+            if (!valid[i]) {
+                continue;
+            }
+            rustsecp256k1_v0_8_1_ecdsa_recoverable_signature_load(ctx, &u1, &s, &recid, sigs[offset + i]);
+            if (!rustsecp256k1_v0_8_1_ecdsa_sig_recover_r(&x, &r[i], recid)) {
+                continue;
+            }
+            rustsecp256k1_v0_8_1_gej_set_ge(&xj, &x);
+            rustsecp256k1_v0_8_1_scalar_set_b32(&m, msghash32[offset + i], NULL);
+            rustsecp256k1_v0_8_1_scalar_mul(&u1, &rn[i], &m);
+            rustsecp256k1_v0_8_1_scalar_negate(&u1, &u1);
+            rustsecp256k1_v0_8_1_scalar_mul(&u2, &rn[i], &s);
+            rustsecp256k1_v0_8_1_ecmult(&qj[i], &xj, &u2, &u1);
+        }
+
+        rustsecp256k1_v0_8_1_ge_set_all_gej_var(q, qj, len);
+        for (i = 0; i < len; i++) {
+            if (rustsecp256k1_v0_8_1_gej_is_infinity(&qj[i])) {
+                ret = 0;
+            } else {
+                rustsecp256k1_v0_8_1_pubkey_save(&pubkeys[offset + i], &q[i]);
+            }
+        }
+    }
+    return ret;
+}
+
+typedef struct {
+    const rustsecp256k1_v0_8_1_context *ctx;
+    const rustsecp256k1_v0_8_1_ecdsa_recoverable_signature *const *sigs;
+    const unsigned char *const *msghash32;
+    const rustsecp256k1_v0_8_1_pubkey *const *pubkeys;
+    /* a_i*r_i/s_i for every signature */
+    const rustsecp256k1_v0_8_1_scalar *u2;
+    unsigned char seed[32];
+} rustsecp256k1_v0_8_1_ecdsa_recoverable_verify_batch_data;
+
+/* Yields (-a_i)*R_i for even indices and (a_i*r_i/s_i)*P_i for odd indices. */
+static int rustsecp256k1_v0_8_1_ecdsa_recoverable_verify_batch_ecmult_callback(rustsecp256k1_v0_8_1_scalar *sc, rustsecp256k1_v0_8_1_ge *pt, size_t idx, void *data) {
+    const rustsecp256k1_v0_8_1_ecdsa_recoverable_verify_batch_data *d = (const rustsecp256k1_v0_8_1_ecdsa_recoverable_verify_batch_data *)data;
+    size_t i = idx / 2;
+
+    if (idx % 2 == 0) {
+        rustsecp256k1_v0_8_1_scalar r, s;
+        int recid;
+        rustsecp256k1_v0_8_1_ecdsa_recoverable_signature_load(d->ctx, &r, &s, &recid, d->sigs[i]);
+        if (!rustsecp256k1_v0_8_1_ecdsa_sig_recover_r(pt, &r, recid)) {
+            return 0;
+        }
+        rustsecp256k1_v0_8_1_batch_randomizer(sc, d->seed, i);
+        rustsecp256k1_v0_8_1_scalar_negate(sc, sc);
+    } else {
+        if (!rustsecp256k1_v0_8_1_pubkey_load(d->ctx, pt, d->pubkeys[i])) {
+            return 0;
+        }
+        *sc = d->u2[i];
+    }
+    return 1;
+}
+
+/* Checks sum(a_i*(m_i/s_i*G + r_i/s_i*P_i - R_i)) == infinity, where R_i is
+ * recovered from r_i and the recovery id. */
+static int rustsecp256k1_v0_8_1_ecdsa_recoverable_verify_batch_ecmult(const rustsecp256k1_v0_8_1_context* ctx, rustsecp256k1_v0_8_1_scratch *scratch, const rustsecp256k1_v0_8_1_ecdsa_recoverable_signature *const *sigs, const unsigned char *const *msghash32, const rustsecp256k1_v0_8_1_pubkey *const *pubkeys, size_t n_sigs) {
+    rustsecp256k1_v0_8_1_ecdsa_recoverable_verify_batch_data data;
+    rustsecp256k1_v0_8_1_sha256 sha;
+    rustsecp256k1_v0_8_1_scalar *s;
+    rustsecp256k1_v0_8_1_scalar *sn;
+    rustsecp256k1_v0_8_1_scalar r, a, m, u1;
+    rustsecp256k1_v0_8_1_gej rj;
+    int recid;
+    size_t i;
+
+    s = (rustsecp256k1_v0_8_1_scalar *)rustsecp256k1_v0_8_1_scratch_alloc(&ctx->error_callback, scratch, n_sigs * sizeof(rustsecp256k1_v0_8_1_scalar));
+    sn = (rustsecp256k1_v0_8_1_scalar *)rustsecp256k1_v0_8_1_scratch_alloc(&ctx->error_callback, scratch, n_sigs * sizeof(rustsecp256k1_v0_8_1_scalar));
+    if (s == NULL || sn == NULL) {
+        return 0;
+    }
+
+    rustsecp256k1_v0_8_1_sha256_initialize_tagged(&sha, (const unsigned char *)"ECDSA/batch", 11);
+    for (i = 0; i < n_sigs; i++) {
+        rustsecp256k1_v0_8_1_ecdsa_recoverable_signature_load(ctx, &r, &s[i], &recid, sigs[i]);
+        if (rustsecp256k1_v0_8_1_scalar_is_zero(&r) || rustsecp256k1_v0_8_1_scalar_is_zero(&s[i]) || rustsecp256k1_v0_8_1_scalar_is_high(&s[i])) {
+            return 0;
+        }
+        rustsecp256k1_v0_8_1_sha256_write(&sha, sigs[i]->data, sizeof(sigs[i]->data));
+        rustsecp256k1_v0_8_1_sha256_write(&sha, msghash32[i], 32);
+        rustsecp256k1_v0_8_1_sha256_write(&sha, pubkeys[i]->data, sizeof(pubkeys[i]->data));
+    }
+    rustsecp256k1_v0_8_1_sha256_finalize(&sha, data.seed);
+
+    rustsecp256k1_v0_8_1_scalar_inverse_all_var(sn, s, n_sigs);
+
+    /* u1 = sum(a_i*m_i/s_i), and the s array is reused for a_i*r_i/s_i. */
+    rustsecp256k1_v0_8_1_scalar_set_int(&u1, 0);
+    for (i = 0; i < n_sigs; i++) {
+        rustsecp256k1_v0_8_1_scalar t;
+        rustsecp256k1_v0_8_1_ecdsa_recoverable_signature_load(ctx, &r, &t, &recid, sigs[i]);
+        rustsecp256k1_v0_8_1_scalar_set_b32(&m, msghash32[i], NULL);
+        rustsecp256k1_v0_8_1_batch_randomizer(&a, data.seed, i);
+        rustsecp256k1_v0_8_1_scalar_mul(&sn[i], &sn[i], &a);
+        rustsecp256k1_v0_8_1_scalar_mul(&m, &m, &sn[i]);
+        rustsecp256k1_v0_8_1_scalar_add(&u1, &u1, &m);
+        rustsecp256k1_v0_8_1_scalar_mul(&s[i], &r, &sn[i]);
+    }
+
+    data.ctx = ctx;
+    data.sigs = sigs;
+    data.msghash32 = msghash32;
+    data.pubkeys = pubkeys;
+    data.u2 = s;
+    if (!rustsecp256k1_v0_8_1_ecmult_multi_var(&ctx->error_callback, scratch, &rj, &u1, rustsecp256k1_v0_8_1_ecdsa_recoverable_verify_batch_ecmult_callback, &data, 2 * n_sigs)) {
+        return 0;
+    }
+    return rustsecp256k1_v0_8_1_gej_is_infinity(&rj);
+}
+
+static int rustsecp256k1_v0_8_1_ecdsa_recoverable_verify_batch_load(const rustsecp256k1_v0_8_1_context* ctx, rustsecp256k1_v0_8_1_scalar *r, rustsecp256k1_v0_8_1_scalar *s, rustsecp256k1_v0_8_1_ge *pubkey, rustsecp256k1_v0_8_1_scalar *message, size_t idx, const void *data) {
+    const rustsecp256k1_v0_8_1_ecdsa_recoverable_verify_batch_data *d = (const rustsecp256k1_v0_8_1_ecdsa_recoverable_verify_batch_data *)data;
+    int recid;
+
+    rustsecp256k1_v0_8_1_scalar_set_b32(message, d->msghash32[idx], NULL);
+    rustsecp256k1_v0_8_1_ecdsa_recoverable_signature_load(ctx, r, s, &recid, d->sigs[idx]);
+    return (!rustsecp256k1_v0_8_1_scalar_is_high(s) &&
+            !rustsecp256k1_v0_8_1_scalar_is_zero(s) &&
+            rustsecp256k1_v0_8_1_pubkey_load(ctx, pubkey, d->pubkeys[idx]));
+}
+
+size_t rustsecp256k1_v0_8_1_ecdsa_recoverable_verify_batch_scratch_size(size_t n_sigs) {
+    return 2 * ROUND_TO_ALIGN(n_sigs * sizeof(rustsecp256k1_v0_8_1_scalar)) + rustsecp256k1_v0_8_1_ecmult_multi_scratch_size(2 * n_sigs);
+}
+
+int rustsecp256k1_v0_8_1_ecdsa_recoverable_verify_batch(const rustsecp256k1_v0_8_1_context* ctx, rustsecp256k1_v0_8_1_scratch_space *scratch, size_t *failed_index, const rustsecp256k1_v0_8_1_ecdsa_recoverable_signature *const *sigs, const unsigned char *const *msghash32, const rustsecp256k1_v0_8_1_pubkey *const *pubkeys, size_t n_sigs) {
+    rustsecp256k1_v0_8_1_ecdsa_recoverable_verify_batch_data data;
+    size_t i;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(n_sigs == 0 || sigs != NULL);
+    ARG_CHECK(n_sigs == 0 || msghash32 != NULL);
+    ARG_CHECK(n_sigs == 0 || pubkeys != NULL);
+    ARG_CHECK(n_sigs <= SIZE_MAX / 2);
+    for (i = 0; i < n_sigs; i++) {
+        ARG_CHECK(sigs[i] != NULL);
+        ARG_CHECK(msghash32[i] != NULL);
+        ARG_CHECK(pubkeys[i] != NULL);
+    }
+
+    if (n_sigs == 0) {
+        return 1;
+    }
+
+    if (scratch != NULL) {
+        const size_t scratch_checkpoint = rustsecp256k1_v0_8_1_scratch_checkpoint(&ctx->error_callback, scratch);
+        int ret = rustsecp256k1_v0_8_1_ecdsa_recoverable_verify_batch_ecmult(ctx, scratch, sigs, msghash32, pubkeys, n_sigs);
+        rustsecp256k1_v0_8_1_scratch_apply_checkpoint(&ctx->error_callback, scratch, scratch_checkpoint);
+        if (ret) {
+            return 1;
+        }
+    }
+
+    /* The combined check failed or could not be evaluated. Verify the signatures
+     * one by one to find the incorrect one. This also accepts signatures that are
+     * correct but carry a recovery id which does not match their R point. */
+    data.ctx = ctx;
+    data.sigs = sigs;
+    data.msghash32 = msghash32;
+    data.pubkeys = pubkeys;
+    return rustsecp256k1_v0_8_1_ecdsa_verify_each_var(ctx, rustsecp256k1_v0_8_1_ecdsa_recoverable_verify_batch_load, &data, n_sigs, failed_index);
+}
+
 #endif /* SECP256K1_MODULE_RECOVERY_MAIN_H */
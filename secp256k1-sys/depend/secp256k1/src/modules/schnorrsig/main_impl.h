@@ -129,6 +129,26 @@ static void rustsecp256k1_v0_8_1_schnorrsig_challenge(rustsecp256k1_v0_8_1_scala
     rustsecp256k1_v0_8_1_scalar_set_b32(e, buf, NULL);
 }
 
+/* Computes the challenges of eight signatures at once, see schnorrsig_challenge. */
+static void rustsecp256k1_v0_8_1_schnorrsig_challenge_x8(rustsecp256k1_v0_8_1_scalar* e, const unsigned char *const *r32, const unsigned char *const *msg, size_t msglen, const unsigned char *const *pubkey32)
+{
+    unsigned char buf[8 * 32];
+    rustsecp256k1_v0_8_1_sha256 sha[8];
+    int k;
+
+    rustsecp256k1_v0_8_1_schnorrsig_sha256_tagged(&sha[0]);
+    for (k = 1; k < 8; k++) {
+        sha[k] = sha[0];
+    }
+    rustsecp256k1_v0_8_1_sha256_write_x8(sha, r32, 32);
+    rustsecp256k1_v0_8_1_sha256_write_x8(sha, pubkey32, 32);
+    rustsecp256k1_v0_8_1_sha256_write_x8(sha, msg, msglen);
+    rustsecp256k1_v0_8_1_sha256_finalize_x8(sha, buf);
+    for (k = 0; k < 8; k++) {
+        rustsecp256k1_v0_8_1_scalar_set_b32(&e[k], &buf[32 * k], NULL);
+    }
+}
+
 static int rustsecp256k1_v0_8_1_schnorrsig_sign_internal(const rustsecp256k1_v0_8_1_context* ctx, unsigned char *sig64, const unsigned char *msg, size_t msglen, const rustsecp256k1_v0_8_1_keypair *keypair, rustsecp256k1_v0_8_1_nonce_function_hardened noncefp, void *ndata) {
     rustsecp256k1_v0_8_1_scalar sk;
     rustsecp256k1_v0_8_1_scalar e;
@@ -216,22 +236,163 @@ int rustsecp256k1_v0_8_1_schnorrsig_sign_custom(const rustsecp256k1_v0_8_1_conte
     return rustsecp256k1_v0_8_1_schnorrsig_sign_internal(ctx, sig64, msg, msglen, keypair, noncefp, ndata);
 }
 
-int rustsecp256k1_v0_8_1_schnorrsig_verify(const rustsecp256k1_v0_8_1_context* ctx, const unsigned char *sig64, const unsigned char *msg, size_t msglen, const rustsecp256k1_v0_8_1_xonly_pubkey *pubkey) {
+/* Computes the nonces of eight signatures at once, as nonce_function_bip340 with the
+ * BIP-340 algo and 32-byte messages. TaggedHash("BIP0340/aux", 0^32) is the mask used
+ * without auxiliary randomness, so aux_rand32 must point to zeros in that case. */
+static void rustsecp256k1_v0_8_1_nonce_function_bip340_x8(unsigned char *nonce32, const unsigned char *const *msg32, const unsigned char *const *key32, const unsigned char *const *xonly_pk32, const unsigned char *const *aux_rand32) {
+    rustsecp256k1_v0_8_1_sha256 sha[8];
+    unsigned char masked_key[8 * 32];
+    const unsigned char *masked_key_ptr[8];
+    int i, k;
+
+    rustsecp256k1_v0_8_1_nonce_function_bip340_sha256_tagged_aux(&sha[0]);
+    for (k = 1; k < 8; k++) {
+        sha[k] = sha[0];
+    }
+    rustsecp256k1_v0_8_1_sha256_write_x8(sha, aux_rand32, 32);
+    rustsecp256k1_v0_8_1_sha256_finalize_x8(sha, masked_key);
+    for (k = 0; k < 8; k++) {
+        for (i = 0; i < 32; i++) {
+            masked_key[32 * k + i] ^= key32[k][i];
+        }
+        masked_key_ptr[k] = &masked_key[32 * k];
+    }
+
+    rustsecp256k1_v0_8_1_nonce_function_bip340_sha256_tagged(&sha[0]);
+    for (k = 1; k < 8; k++) {
+        sha[k] = sha[0];
+    }
+    rustsecp256k1_v0_8_1_sha256_write_x8(sha, masked_key_ptr, 32);
+    rustsecp256k1_v0_8_1_sha256_write_x8(sha, xonly_pk32, 32);
+    rustsecp256k1_v0_8_1_sha256_write_x8(sha, msg32, 32);
+    rustsecp256k1_v0_8_1_sha256_finalize_x8(sha, nonce32);
+    memset(masked_key, 0, sizeof(masked_key));
+    memset(sha, 0, sizeof(sha));
+}
+
+/* Number of signatures sharing one field inversion in schnorrsig_sign_batch, a multiple of the
+ * eight hashes computed at once. */
+#define SCHNORRSIG_SIGN_BATCH_CHUNK 64
+
+int rustsecp256k1_v0_8_1_schnorrsig_sign_batch(const rustsecp256k1_v0_8_1_context* ctx, unsigned char *sig64, const unsigned char *const *msg32, const rustsecp256k1_v0_8_1_keypair *const *keypairs, const unsigned char *const *aux_rand32, size_t n) {
+    static const unsigned char zero_aux[32] = { 0 };
+    rustsecp256k1_v0_8_1_scalar sk[SCHNORRSIG_SIGN_BATCH_CHUNK];
+    rustsecp256k1_v0_8_1_scalar k[SCHNORRSIG_SIGN_BATCH_CHUNK];
+    rustsecp256k1_v0_8_1_scalar e[8];
+    rustsecp256k1_v0_8_1_gej rj[SCHNORRSIG_SIGN_BATCH_CHUNK];
+    rustsecp256k1_v0_8_1_ge r[SCHNORRSIG_SIGN_BATCH_CHUNK];
+    unsigned char seckey[SCHNORRSIG_SIGN_BATCH_CHUNK][32];
+    unsigned char pk_buf[SCHNORRSIG_SIGN_BATCH_CHUNK][32];
+    unsigned char nonce[8 * 32];
+    int ok[SCHNORRSIG_SIGN_BATCH_CHUNK];
+    const unsigned char *msg[8];
+    const unsigned char *key[8];
+    const unsigned char *pk[8];
+    const unsigned char *aux[8];
+    const unsigned char *r32[8];
+    int ret = 1;
+    size_t offset;
+    size_t i, j, g;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(rustsecp256k1_v0_8_1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
+    ARG_CHECK(n == 0 || sig64 != NULL);
+    ARG_CHECK(n == 0 || msg32 != NULL);
+    ARG_CHECK(n == 0 || keypairs != NULL);
+    for (i = 0; i < n; i++) {
+        ARG_CHECK(msg32[i] != NULL);
+        ARG_CHECK(keypairs[i] != NULL);
+    }
+
+    for (offset = 0; offset < n; offset += SCHNORRSIG_SIGN_BATCH_CHUNK) {
+        size_t len = n - offset < SCHNORRSIG_SIGN_BATCH_CHUNK ? n - offset : SCHNORRSIG_SIGN_BATCH_CHUNK;
+
+        for (i = 0; i < len; i++) {
+            rustsecp256k1_v0_8_1_ge pkp;
+            ok[i] = rustsecp256k1_v0_8_1_keypair_load(ctx, &sk[i], &pkp, keypairs[offset + i]);
+            /* Signing for the x-only public key, see schnorrsig_sign_internal. */
+            if (rustsecp256k1_v0_8_1_fe_is_odd(&pkp.y)) {
+                rustsecp256k1_v0_8_1_scalar_negate(&sk[i], &sk[i]);
+            }
+            rustsecp256k1_v0_8_1_scalar_get_b32(seckey[i], &sk[i]);
+            rustsecp256k1_v0_8_1_fe_get_b32(pk_buf[i], &pkp.x);
+        }
+
+        /* Nonces in groups of eight, the lanes past the end repeat the first signature. */
+        for (g = 0; g < len; g += 8) {
+            for (j = 0; j < 8; j++) {
+                i = g + j < len ? g + j : g;
+                msg[j] = msg32[offset + i];
+                key[j] = seckey[i];
+                pk[j] = pk_buf[i];
+                aux[j] = aux_rand32 != NULL && aux_rand32[offset + i] != NULL ? aux_rand32[offset + i] : zero_aux;
+            }
+            rustsecp256k1_v0_8_1_nonce_function_bip340_x8(nonce, msg, key, pk, aux);
+            for (j = 0; j < 8 && g + j < len; j++) {
+                i = g + j;
+                rustsecp256k1_v0_8_1_scalar_set_b32(&k[i], &nonce[32 * j], NULL);
+                ok[i] &= !rustsecp256k1_v0_8_1_scalar_is_zero(&k[i]);
+                rustsecp256k1_v0_8_1_scalar_cmov(&k[i], &rustsecp256k1_v0_8_1_scalar_one, !ok[i]);
+                rustsecp256k1_v0_8_1_ecmult_gen(&ctx->ecmult_gen_ctx, &rj[i], &k[i]);
+            }
+        }
+        rustsecp256k1_v0_8_1_ge_set_all_gej(r, rj, len);
+
+        for (i = 0; i < len; i++) {
+            unsigned char *sig = &sig64[64 * (offset + i)];
+            /* We declassify r to allow using it as a branch point. This is fine
+             * because r is not a secret. */
+            rustsecp256k1_v0_8_1_declassify(ctx, &r[i], sizeof(r[i]));
+            rustsecp256k1_v0_8_1_fe_normalize_var(&r[i].y);
+            if (rustsecp256k1_v0_8_1_fe_is_odd(&r[i].y)) {
+                rustsecp256k1_v0_8_1_scalar_negate(&k[i], &k[i]);
+            }
+            rustsecp256k1_v0_8_1_fe_normalize_var(&r[i].x);
+            rustsecp256k1_v0_8_1_fe_get_b32(&sig[0], &r[i].x);
+        }
+
+        for (g = 0; g < len; g += 8) {
+            for (j = 0; j < 8; j++) {
+                i = g + j < len ? g + j : g;
+                r32[j] = &sig64[64 * (offset + i)];
+                msg[j] = msg32[offset + i];
+                pk[j] = pk_buf[i];
+            }
+            rustsecp256k1_v0_8_1_schnorrsig_challenge_x8(e, r32, msg, 32, pk);
+            for (j = 0; j < 8 && g + j < len; j++) {
+                unsigned char *sig;
+                i = g + j;
+                sig = &sig64[64 * (offset + i)];
+                rustsecp256k1_v0_8_1_scalar_mul(&e[j], &e[j], &sk[i]);
+                rustsecp256k1_v0_8_1_scalar_add(&e[j], &e[j], &k[i]);
+                rustsecp256k1_v0_8_1_scalar_get_b32(&sig[32], &e[j]);
+                rustsecp256k1_v0_8_1_memczero(sig, 64, !ok[i]);
+                ret &= ok[i];
+            }
+        }
+    }
+
+    memset(sk, 0, sizeof(sk));
+    memset(k, 0, sizeof(k));
+    memset(e, 0, sizeof(e));
+    memset(rj, 0, sizeof(rj));
+    memset(seckey, 0, sizeof(seckey));
+    memset(nonce, 0, sizeof(nonce));
+    return ret;
+}
+
+/* Verifies a signature for the public key pk. If pre is not NULL, it holds the
+ * table of pk filled by ecmult_prepare_table. */
+static int rustsecp256k1_v0_8_1_schnorrsig_verify_ge(const unsigned char *sig64, const unsigned char *msg, size_t msglen, rustsecp256k1_v0_8_1_ge *pk, const rustsecp256k1_v0_8_1_ge_storage *pre) {
     rustsecp256k1_v0_8_1_scalar s;
     rustsecp256k1_v0_8_1_scalar e;
     rustsecp256k1_v0_8_1_gej rj;
-    rustsecp256k1_v0_8_1_ge pk;
     rustsecp256k1_v0_8_1_gej pkj;
     rustsecp256k1_v0_8_1_fe rx;
     rustsecp256k1_v0_8_1_ge r;
     unsigned char buf[32];
     int overflow;
 
-    VERIFY_CHECK(ctx != NULL);
-    ARG_CHECK(sig64 != NULL);
-    ARG_CHECK(msg != NULL || msglen == 0);
-    ARG_CHECK(pubkey != NULL);
-
     if (!rustsecp256k1_v0_8_1_fe_set_b32(&rx, &sig64[0])) {
         return 0;
     }
@@ -241,18 +402,19 @@ int rustsecp256k1_v0_8_1_schnorrsig_verify(const rustsecp256k1_v0_8_1_context* c
         return 0;
     }
 
-    if (!rustsecp256k1_v0_8_1_xonly_pubkey_load(ctx, &pk, pubkey)) {
-        return 0;
-    }
-
     /* Compute e. */
-    rustsecp256k1_v0_8_1_fe_get_b32(buf, &pk.x);
+    rustsecp256k1_v0_8_1_fe_normalize_var(&pk->x);
+    rustsecp256k1_v0_8_1_fe_get_b32(buf, &pk->x);
     rustsecp256k1_v0_8_1_schnorrsig_challenge(&e, &sig64[0], msg, msglen, buf);
 
     /* Compute rj =  s*G + (-e)*pkj */
     rustsecp256k1_v0_8_1_scalar_negate(&e, &e);
-    rustsecp256k1_v0_8_1_gej_set_ge(&pkj, &pk);
-    rustsecp256k1_v0_8_1_ecmult(&rj, &pkj, &e, &s);
+    if (pre != NULL) {
+        rustsecp256k1_v0_8_1_ecmult_prepared(&rj, pre, &e, &s);
+    } else {
+        rustsecp256k1_v0_8_1_gej_set_ge(&pkj, pk);
+        rustsecp256k1_v0_8_1_ecmult(&rj, &pkj, &e, &s);
+    }
 
     rustsecp256k1_v0_8_1_ge_set_gej_var(&r, &rj);
     if (rustsecp256k1_v0_8_1_ge_is_infinity(&r)) {
@@ -264,4 +426,178 @@ int rustsecp256k1_v0_8_1_schnorrsig_verify(const rustsecp256k1_v0_8_1_context* c
            rustsecp256k1_v0_8_1_fe_equal_var(&rx, &r.x);
 }
 
+int rustsecp256k1_v0_8_1_schnorrsig_verify(const rustsecp256k1_v0_8_1_context* ctx, const unsigned char *sig64, const unsigned char *msg, size_t msglen, const rustsecp256k1_v0_8_1_xonly_pubkey *pubkey) {
+    rustsecp256k1_v0_8_1_ge pk;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(sig64 != NULL);
+    ARG_CHECK(msg != NULL || msglen == 0);
+    ARG_CHECK(pubkey != NULL);
+
+    if (!rustsecp256k1_v0_8_1_xonly_pubkey_load(ctx, &pk, pubkey)) {
+        return 0;
+    }
+    return rustsecp256k1_v0_8_1_schnorrsig_verify_ge(sig64, msg, msglen, &pk, NULL);
+}
+
+int rustsecp256k1_v0_8_1_schnorrsig_verify_prepared(const rustsecp256k1_v0_8_1_context* ctx, const unsigned char *sig64, const unsigned char *msg, size_t msglen, const rustsecp256k1_v0_8_1_prepared_pubkey *prepared) {
+    rustsecp256k1_v0_8_1_ge_storage pre[ECMULT_TABLE_SIZE(ECMULT_PREPARED_WINDOW)];
+    rustsecp256k1_v0_8_1_ge pk;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(sig64 != NULL);
+    ARG_CHECK(msg != NULL || msglen == 0);
+    ARG_CHECK(prepared != NULL);
+
+    if (!rustsecp256k1_v0_8_1_prepared_pubkey_load(ctx, pre, prepared)) {
+        return 0;
+    }
+    /* The first entry of the table is the public key itself. */
+    rustsecp256k1_v0_8_1_ge_from_storage(&pk, &pre[0]);
+    rustsecp256k1_v0_8_1_fe_normalize_var(&pk.y);
+    ARG_CHECK(!rustsecp256k1_v0_8_1_fe_is_odd(&pk.y));
+    return rustsecp256k1_v0_8_1_schnorrsig_verify_ge(sig64, msg, msglen, &pk, pre);
+}
+
+/* "BIP0340/batch" tag used to derive the batch verification randomizers. */
+static const unsigned char rustsecp256k1_v0_8_1_schnorrsig_batch_tag[13] = "BIP0340/batch";
+
+typedef struct {
+    const rustsecp256k1_v0_8_1_context *ctx;
+    const unsigned char *const *sig64;
+    const unsigned char *const *msg32;
+    const rustsecp256k1_v0_8_1_xonly_pubkey *const *pubkeys;
+    size_t n_sigs;
+    unsigned char seed[32];
+    /* Randomizers, challenges and public keys of the group of eight signatures
+     * starting at group_idx, the group most recently handed to ecmult_multi.
+     * Grouping lets the hashes be computed eight at a time. */
+    rustsecp256k1_v0_8_1_scalar randomizers[8];
+    rustsecp256k1_v0_8_1_scalar challenges[8];
+    rustsecp256k1_v0_8_1_ge pks[8];
+    int pks_valid[8];
+    size_t group_idx;
+} rustsecp256k1_v0_8_1_schnorrsig_verify_batch_data;
+
+static void rustsecp256k1_v0_8_1_schnorrsig_verify_batch_load_group(rustsecp256k1_v0_8_1_schnorrsig_verify_batch_data *d, size_t group_idx) {
+    unsigned char pk32[8][32];
+    const unsigned char *r32[8];
+    const unsigned char *msg[8];
+    const unsigned char *pubkey32[8];
+    size_t i;
+    int k;
+
+    for (k = 0; k < 8; k++) {
+        /* Lanes past the end of the batch hash a copy of the first signature. */
+        i = group_idx + k < d->n_sigs ? group_idx + k : group_idx;
+        d->pks_valid[k] = rustsecp256k1_v0_8_1_xonly_pubkey_load(d->ctx, &d->pks[k], d->pubkeys[i]);
+        if (d->pks_valid[k]) {
+            rustsecp256k1_v0_8_1_fe_get_b32(pk32[k], &d->pks[k].x);
+        } else {
+            memset(pk32[k], 0, sizeof(pk32[k]));
+        }
+        r32[k] = &d->sig64[i][0];
+        msg[k] = d->msg32[i];
+        pubkey32[k] = pk32[k];
+    }
+    rustsecp256k1_v0_8_1_schnorrsig_challenge_x8(d->challenges, r32, msg, 32, pubkey32);
+    rustsecp256k1_v0_8_1_batch_randomizer_x8(d->randomizers, d->seed, group_idx);
+    d->group_idx = group_idx;
+}
+
+/* Yields a_i*R_i for even indices and (a_i*e_i)*P_i for odd indices. */
+static int rustsecp256k1_v0_8_1_schnorrsig_verify_batch_ecmult_callback(rustsecp256k1_v0_8_1_scalar *sc, rustsecp256k1_v0_8_1_ge *pt, size_t idx, void *data) {
+    rustsecp256k1_v0_8_1_schnorrsig_verify_batch_data *d = (rustsecp256k1_v0_8_1_schnorrsig_verify_batch_data *)data;
+    size_t i = idx / 2;
+    size_t k = i % 8;
+
+    if (i - k != d->group_idx) {
+        rustsecp256k1_v0_8_1_schnorrsig_verify_batch_load_group(d, i - k);
+    }
+
+    if (idx % 2 == 0) {
+        rustsecp256k1_v0_8_1_fe rx;
+        if (!rustsecp256k1_v0_8_1_fe_set_b32(&rx, &d->sig64[i][0])) {
+            return 0;
+        }
+        if (!rustsecp256k1_v0_8_1_ge_set_xo_var(pt, &rx, 0)) {
+            return 0;
+        }
+        *sc = d->randomizers[k];
+    } else {
+        if (!d->pks_valid[k]) {
+            return 0;
+        }
+        *pt = d->pks[k];
+        rustsecp256k1_v0_8_1_scalar_mul(sc, &d->challenges[k], &d->randomizers[k]);
+    }
+    return 1;
+}
+
+size_t rustsecp256k1_v0_8_1_schnorrsig_verify_batch_scratch_size(size_t n_sigs) {
+    return rustsecp256k1_v0_8_1_ecmult_multi_scratch_size(2 * n_sigs);
+}
+
+int rustsecp256k1_v0_8_1_schnorrsig_verify_batch(const rustsecp256k1_v0_8_1_context* ctx, rustsecp256k1_v0_8_1_scratch_space *scratch, const unsigned char *const *sig64, const unsigned char *const *msg32, const rustsecp256k1_v0_8_1_xonly_pubkey *const *pubkeys, size_t n_sigs) {
+    rustsecp256k1_v0_8_1_schnorrsig_verify_batch_data data;
+    rustsecp256k1_v0_8_1_sha256 sha;
+    rustsecp256k1_v0_8_1_scalar s;
+    rustsecp256k1_v0_8_1_scalar a[8];
+    rustsecp256k1_v0_8_1_scalar sum_s;
+    rustsecp256k1_v0_8_1_gej rj;
+    size_t i;
+    int overflow;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(n_sigs == 0 || sig64 != NULL);
+    ARG_CHECK(n_sigs == 0 || msg32 != NULL);
+    ARG_CHECK(n_sigs == 0 || pubkeys != NULL);
+    ARG_CHECK(n_sigs <= SIZE_MAX / 2);
+
+    if (n_sigs == 0) {
+        return 1;
+    }
+
+    /* The randomizers are derived from a hash of the whole batch, so that they
+     * cannot be predicted by whoever chose the signatures. */
+    rustsecp256k1_v0_8_1_sha256_initialize_tagged(&sha, rustsecp256k1_v0_8_1_schnorrsig_batch_tag, sizeof(rustsecp256k1_v0_8_1_schnorrsig_batch_tag));
+    for (i = 0; i < n_sigs; i++) {
+        ARG_CHECK(sig64[i] != NULL);
+        ARG_CHECK(msg32[i] != NULL);
+        ARG_CHECK(pubkeys[i] != NULL);
+        rustsecp256k1_v0_8_1_sha256_write(&sha, sig64[i], 64);
+        rustsecp256k1_v0_8_1_sha256_write(&sha, msg32[i], 32);
+        rustsecp256k1_v0_8_1_sha256_write(&sha, pubkeys[i]->data, sizeof(pubkeys[i]->data));
+    }
+    rustsecp256k1_v0_8_1_sha256_finalize(&sha, data.seed);
+
+    /* Compute sum_s = -(a_0*s_0 + ... + a_{n-1}*s_{n-1}). */
+    rustsecp256k1_v0_8_1_scalar_set_int(&sum_s, 0);
+    for (i = 0; i < n_sigs; i++) {
+        rustsecp256k1_v0_8_1_scalar_set_b32(&s, &sig64[i][32], &overflow);
+        if (overflow) {
+            return 0;
+        }
+        if (i % 8 == 0) {
+            rustsecp256k1_v0_8_1_batch_randomizer_x8(a, data.seed, i);
+        }
+        rustsecp256k1_v0_8_1_scalar_mul(&s, &s, &a[i % 8]);
+        rustsecp256k1_v0_8_1_scalar_add(&sum_s, &sum_s, &s);
+    }
+    rustsecp256k1_v0_8_1_scalar_negate(&sum_s, &sum_s);
+
+    data.ctx = ctx;
+    data.sig64 = sig64;
+    data.msg32 = msg32;
+    data.pubkeys = pubkeys;
+    data.n_sigs = n_sigs;
+    data.group_idx = SIZE_MAX;
+
+    /* Check sum_s*G + sum(a_i*R_i + (a_i*e_i)*P_i) == infinity. */
+    if (!rustsecp256k1_v0_8_1_ecmult_multi_var(&ctx->error_callback, scratch, &rj, &sum_s, rustsecp256k1_v0_8_1_schnorrsig_verify_batch_ecmult_callback, &data, 2 * n_sigs)) {
+        return 0;
+    }
+    return rustsecp256k1_v0_8_1_gej_is_infinity(&rj);
+}
+
 #endif
@@ -68,6 +68,14 @@ static void rustsecp256k1_v0_8_1_scalar_inverse(rustsecp256k1_v0_8_1_scalar *r,
 /** Compute the inverse of a scalar (modulo the group order), without constant-time guarantee. */
 static void rustsecp256k1_v0_8_1_scalar_inverse_var(rustsecp256k1_v0_8_1_scalar *r, const rustsecp256k1_v0_8_1_scalar *a);
 
+/** Compute the inverses of len nonzero scalars with a single inversion (Montgomery's trick),
+ *  without constant-time guarantee. r and a must not overlap. */
+static void rustsecp256k1_v0_8_1_scalar_inverse_all_var(rustsecp256k1_v0_8_1_scalar *r, const rustsecp256k1_v0_8_1_scalar *a, size_t len);
+
+/** Compute the inverses of len nonzero scalars with a single inversion (Montgomery's trick).
+ *  Constant time. r and a must not overlap. */
+static void rustsecp256k1_v0_8_1_scalar_inverse_all(rustsecp256k1_v0_8_1_scalar *r, const rustsecp256k1_v0_8_1_scalar *a, size_t len);
+
 /** Compute the complement of a scalar (modulo the group order). */
 static void rustsecp256k1_v0_8_1_scalar_negate(rustsecp256k1_v0_8_1_scalar *r, const rustsecp256k1_v0_8_1_scalar *a);
 
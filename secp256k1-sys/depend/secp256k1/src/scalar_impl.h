@@ -37,6 +37,58 @@ static int rustsecp256k1_v0_8_1_scalar_set_b32_seckey(rustsecp256k1_v0_8_1_scala
     return (!overflow) & (!rustsecp256k1_v0_8_1_scalar_is_zero(r));
 }
 
+static void rustsecp256k1_v0_8_1_scalar_inverse_all_var(rustsecp256k1_v0_8_1_scalar *r, const rustsecp256k1_v0_8_1_scalar *a, size_t len) {
+    rustsecp256k1_v0_8_1_scalar u;
+    size_t i;
+    if (len < 1) {
+        return;
+    }
+
+    VERIFY_CHECK((r + len <= a) || (a + len <= r));
+
+    r[0] = a[0];
+
+    i = 0;
+    while (++i < len) {
+        rustsecp256k1_v0_8_1_scalar_mul(&r[i], &r[i - 1], &a[i]);
+    }
+
+    rustsecp256k1_v0_8_1_scalar_inverse_var(&u, &r[--i]);
+
+    while (i > 0) {
+        size_t j = i--;
+        rustsecp256k1_v0_8_1_scalar_mul(&r[j], &r[i], &u);
+        rustsecp256k1_v0_8_1_scalar_mul(&u, &u, &a[j]);
+    }
+
+    r[0] = u;
+}
+
+static void rustsecp256k1_v0_8_1_scalar_inverse_all(rustsecp256k1_v0_8_1_scalar *r, const rustsecp256k1_v0_8_1_scalar *a, size_t len) {
+    rustsecp256k1_v0_8_1_scalar u;
+    size_t i;
+    if (len < 1) {
+        return;
+    }
+
+    VERIFY_CHECK((r + len <= a) || (a + len <= r));
+
+    r[0] = a[0];
+    for (i = 1; i < len; i++) {
+        rustsecp256k1_v0_8_1_scalar_mul(&r[i], &r[i - 1], &a[i]);
+    }
+
+    rustsecp256k1_v0_8_1_scalar_inverse(&u, &r[len - 1]);
+
+    for (i = len - 1; i > 0; i--) {
+        rustsecp256k1_v0_8_1_scalar_mul(&r[i], &r[i - 1], &u);
+        rustsecp256k1_v0_8_1_scalar_mul(&u, &u, &a[i]);
+    }
+
+    r[0] = u;
+    rustsecp256k1_v0_8_1_scalar_clear(&u);
+}
+
 /* These parameters are generated using sage/gen_exhaustive_groups.sage. */
 #if defined(EXHAUSTIVE_TEST_ORDER)
 #  if EXHAUSTIVE_TEST_ORDER == 13
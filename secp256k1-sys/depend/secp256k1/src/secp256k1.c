@@ -141,6 +141,112 @@ void rustsecp256k1_v0_8_1_context_preallocated_destroy(rustsecp256k1_v0_8_1_cont
     }
 }
 
+/* Returns the scratch space size that lets ecmult_multi_var multiply n_points
+ * points in a single batch with the algorithm it picks for that many points. */
+static size_t rustsecp256k1_v0_8_1_ecmult_multi_scratch_size(size_t n_points) {
+    if (n_points >= ECMULT_PIPPENGER_THRESHOLD) {
+        int bucket_window = rustsecp256k1_v0_8_1_pippenger_bucket_window(n_points);
+        return rustsecp256k1_v0_8_1_pippenger_scratch_size(n_points, bucket_window) + PIPPENGER_SCRATCH_OBJECTS * ALIGNMENT;
+    }
+    return rustsecp256k1_v0_8_1_strauss_scratch_size(n_points) + STRAUSS_SCRATCH_OBJECTS * ALIGNMENT;
+}
+
+/* Derives the randomizer a_i for the i-th signature of a batch from a seed that
+ * commits to the whole batch. The first randomizer is fixed to 1, which saves
+ * one scalar multiplication without weakening the check. */
+static void rustsecp256k1_v0_8_1_batch_randomizer(rustsecp256k1_v0_8_1_scalar *a, const unsigned char *seed32, size_t i) {
+    rustsecp256k1_v0_8_1_sha256 sha;
+    unsigned char buf[32];
+    unsigned char idx[8];
+    uint64_t i64 = i;
+    int j;
+
+    if (i == 0) {
+        rustsecp256k1_v0_8_1_scalar_set_int(a, 1);
+        return;
+    }
+    for (j = 0; j < 8; j++) {
+        idx[j] = (i64 >> (8 * j)) & 0xff;
+    }
+    rustsecp256k1_v0_8_1_sha256_initialize(&sha);
+    rustsecp256k1_v0_8_1_sha256_write(&sha, seed32, 32);
+    rustsecp256k1_v0_8_1_sha256_write(&sha, idx, sizeof(idx));
+    rustsecp256k1_v0_8_1_sha256_finalize(&sha, buf);
+    rustsecp256k1_v0_8_1_scalar_set_b32(a, buf, NULL);
+}
+
+/* Derives the randomizers a_i, ..., a_{i+7} at once, see batch_randomizer. */
+static void rustsecp256k1_v0_8_1_batch_randomizer_x8(rustsecp256k1_v0_8_1_scalar *a, const unsigned char *seed32, size_t i) {
+    rustsecp256k1_v0_8_1_sha256 sha[8];
+    unsigned char buf[8 * 32];
+    unsigned char idx[8][8];
+    const unsigned char *data[8];
+    int j, k;
+
+    rustsecp256k1_v0_8_1_sha256_initialize(&sha[0]);
+    rustsecp256k1_v0_8_1_sha256_write(&sha[0], seed32, 32);
+    for (k = 0; k < 8; k++) {
+        uint64_t i64 = i + k;
+        sha[k] = sha[0];
+        for (j = 0; j < 8; j++) {
+            idx[k][j] = (i64 >> (8 * j)) & 0xff;
+        }
+        data[k] = idx[k];
+    }
+    rustsecp256k1_v0_8_1_sha256_write_x8(sha, data, sizeof(idx[0]));
+    rustsecp256k1_v0_8_1_sha256_finalize_x8(sha, buf);
+    for (k = 0; k < 8; k++) {
+        rustsecp256k1_v0_8_1_scalar_set_b32(&a[k], &buf[32 * k], NULL);
+    }
+    if (i == 0) {
+        rustsecp256k1_v0_8_1_scalar_set_int(&a[0], 1);
+    }
+}
+
+size_t rustsecp256k1_v0_8_1_scratch_space_preallocated_size(size_t size) {
+    return ROUND_TO_ALIGN(sizeof(rustsecp256k1_v0_8_1_scratch)) + size;
+}
+
+rustsecp256k1_v0_8_1_scratch_space* rustsecp256k1_v0_8_1_scratch_space_preallocated_create(const rustsecp256k1_v0_8_1_context* ctx, void* prealloc, size_t size) {
+    const size_t base_alloc = ROUND_TO_ALIGN(sizeof(rustsecp256k1_v0_8_1_scratch));
+    rustsecp256k1_v0_8_1_scratch* ret;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(prealloc != NULL);
+
+    ret = (rustsecp256k1_v0_8_1_scratch*)prealloc;
+    memset(ret, 0, sizeof(*ret));
+    memcpy(ret->magic, "scratch", 8);
+    ret->data = (void *) ((char *) prealloc + base_alloc);
+    ret->max_size = size;
+    return ret;
+}
+
+void rustsecp256k1_v0_8_1_scratch_space_preallocated_destroy(const rustsecp256k1_v0_8_1_context* ctx, rustsecp256k1_v0_8_1_scratch_space* scratch) {
+    VERIFY_CHECK(ctx != NULL);
+    if (scratch != NULL) {
+        if (rustsecp256k1_v0_8_1_memcmp_var(scratch->magic, "scratch", 8) != 0) {
+            rustsecp256k1_v0_8_1_callback_call(&ctx->error_callback, "invalid scratch space");
+            return;
+        }
+        VERIFY_CHECK(scratch->alloc_size == 0); /* all checkpoints should be applied */
+        memset(scratch->magic, 0, sizeof(scratch->magic));
+    }
+}
+
+size_t rustsecp256k1_v0_8_1_scratch_space_checkpoint(const rustsecp256k1_v0_8_1_context* ctx, const rustsecp256k1_v0_8_1_scratch_space* scratch) {
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(scratch != NULL);
+    return rustsecp256k1_v0_8_1_scratch_checkpoint(&ctx->error_callback, scratch);
+}
+
+void rustsecp256k1_v0_8_1_scratch_space_apply_checkpoint(const rustsecp256k1_v0_8_1_context* ctx, rustsecp256k1_v0_8_1_scratch_space* scratch, size_t checkpoint) {
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK_NO_RETURN(scratch != NULL);
+    if (scratch != NULL) {
+        rustsecp256k1_v0_8_1_scratch_apply_checkpoint(&ctx->error_callback, scratch, checkpoint);
+    }
+}
+
 void rustsecp256k1_v0_8_1_context_set_illegal_callback(rustsecp256k1_v0_8_1_context* ctx, void (*fun)(const char* message, void* data), const void* data) {
     ARG_CHECK_NO_RETURN(ctx != rustsecp256k1_v0_8_1_context_static);
     if (fun == NULL) {
@@ -206,6 +312,50 @@ static void rustsecp256k1_v0_8_1_pubkey_save(rustsecp256k1_v0_8_1_pubkey* pubkey
     }
 }
 
+#if ECMULT_TABLE_SIZE(ECMULT_PREPARED_WINDOW) * 64 > 4096
+#  error ECMULT_PREPARED_WINDOW too large for rustsecp256k1_v0_8_1_prepared_pubkey
+#endif
+
+/* Loads the table of a prepared public key, whose entries use the same
+ * representation as rustsecp256k1_v0_8_1_pubkey. */
+static int rustsecp256k1_v0_8_1_prepared_pubkey_load(const rustsecp256k1_v0_8_1_context* ctx, rustsecp256k1_v0_8_1_ge_storage *pre, const rustsecp256k1_v0_8_1_prepared_pubkey* prepared) {
+    int i;
+    if (sizeof(rustsecp256k1_v0_8_1_ge_storage) == 64) {
+        memcpy(pre, &prepared->data[0], ECMULT_TABLE_SIZE(ECMULT_PREPARED_WINDOW) * sizeof(*pre));
+    } else {
+        for (i = 0; i < ECMULT_TABLE_SIZE(ECMULT_PREPARED_WINDOW); i++) {
+            rustsecp256k1_v0_8_1_fe x, y;
+            rustsecp256k1_v0_8_1_ge ge;
+            rustsecp256k1_v0_8_1_fe_set_b32(&x, prepared->data + 64 * i);
+            rustsecp256k1_v0_8_1_fe_set_b32(&y, prepared->data + 64 * i + 32);
+            rustsecp256k1_v0_8_1_ge_set_xy(&ge, &x, &y);
+            rustsecp256k1_v0_8_1_ge_to_storage(&pre[i], &ge);
+        }
+    }
+    {
+        rustsecp256k1_v0_8_1_ge ge;
+        rustsecp256k1_v0_8_1_ge_from_storage(&ge, &pre[0]);
+        ARG_CHECK(!rustsecp256k1_v0_8_1_fe_is_zero(&ge.x));
+    }
+    return 1;
+}
+
+static void rustsecp256k1_v0_8_1_prepared_pubkey_save(rustsecp256k1_v0_8_1_prepared_pubkey* prepared, const rustsecp256k1_v0_8_1_ge_storage *pre) {
+    int i;
+    if (sizeof(rustsecp256k1_v0_8_1_ge_storage) == 64) {
+        memcpy(&prepared->data[0], pre, ECMULT_TABLE_SIZE(ECMULT_PREPARED_WINDOW) * sizeof(*pre));
+    } else {
+        for (i = 0; i < ECMULT_TABLE_SIZE(ECMULT_PREPARED_WINDOW); i++) {
+            rustsecp256k1_v0_8_1_ge ge;
+            rustsecp256k1_v0_8_1_ge_from_storage(&ge, &pre[i]);
+            rustsecp256k1_v0_8_1_fe_normalize_var(&ge.x);
+            rustsecp256k1_v0_8_1_fe_normalize_var(&ge.y);
+            rustsecp256k1_v0_8_1_fe_get_b32(prepared->data + 64 * i, &ge.x);
+            rustsecp256k1_v0_8_1_fe_get_b32(prepared->data + 64 * i + 32, &ge.y);
+        }
+    }
+}
+
 int rustsecp256k1_v0_8_1_ec_pubkey_parse(const rustsecp256k1_v0_8_1_context* ctx, rustsecp256k1_v0_8_1_pubkey* pubkey, const unsigned char *input, size_t inputlen) {
     rustsecp256k1_v0_8_1_ge Q;
 
@@ -224,6 +374,55 @@ int rustsecp256k1_v0_8_1_ec_pubkey_parse(const rustsecp256k1_v0_8_1_context* ctx
     return 1;
 }
 
+int rustsecp256k1_v0_8_1_ec_pubkey_parse_batch(const rustsecp256k1_v0_8_1_context* ctx, rustsecp256k1_v0_8_1_pubkey *pubkeys, const unsigned char *const *inputs, size_t inputlen, size_t n) {
+    size_t i = 0;
+    int ret = 1;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(n == 0 || pubkeys != NULL);
+    if (n > 0) {
+        memset(pubkeys, 0, sizeof(*pubkeys) * n);
+    }
+    ARG_CHECK(n == 0 || inputs != NULL);
+    for (i = 0; i < n; i++) {
+        ARG_CHECK(inputs[i] != NULL);
+    }
+
+    i = 0;
+#if defined(USE_AVX2_DISPATCH)
+    /* Decompress compressed keys four at a time, taking the square roots with AVX2. */
+    if (inputlen == 33 && rustsecp256k1_v0_8_1_have_avx2()) {
+        rustsecp256k1_v0_8_1_ge Q[4];
+        rustsecp256k1_v0_8_1_fe x[4];
+        int valid[4], odd[4], on_curve[4];
+        size_t k;
+        for (; i + 4 <= n; i += 4) {
+            for (k = 0; k < 4; k++) {
+                const unsigned char *input = inputs[i + k];
+                valid[k] = (input[0] == SECP256K1_TAG_PUBKEY_EVEN || input[0] == SECP256K1_TAG_PUBKEY_ODD)
+                    && rustsecp256k1_v0_8_1_fe_set_b32(&x[k], input + 1);
+                odd[k] = input[0] == SECP256K1_TAG_PUBKEY_ODD;
+                if (!valid[k]) {
+                    rustsecp256k1_v0_8_1_fe_clear(&x[k]);
+                }
+            }
+            rustsecp256k1_v0_8_1_ge_set_xo_var_x4(Q, on_curve, x, odd);
+            for (k = 0; k < 4; k++) {
+                if (valid[k] && on_curve[k] && rustsecp256k1_v0_8_1_ge_is_in_correct_subgroup(&Q[k])) {
+                    rustsecp256k1_v0_8_1_pubkey_save(&pubkeys[i + k], &Q[k]);
+                } else {
+                    ret = 0;
+                }
+            }
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        ret &= rustsecp256k1_v0_8_1_ec_pubkey_parse(ctx, &pubkeys[i], inputs[i], inputlen);
+    }
+    return ret;
+}
+
 int rustsecp256k1_v0_8_1_ec_pubkey_serialize(const rustsecp256k1_v0_8_1_context* ctx, unsigned char *output, size_t *outputlen, const rustsecp256k1_v0_8_1_pubkey* pubkey, unsigned int flags) {
     rustsecp256k1_v0_8_1_ge Q;
     size_t len;
@@ -394,6 +593,116 @@ int rustsecp256k1_v0_8_1_ecdsa_verify(const rustsecp256k1_v0_8_1_context* ctx, c
             rustsecp256k1_v0_8_1_ecdsa_sig_verify(&r, &s, &q, &m));
 }
 
+int rustsecp256k1_v0_8_1_ec_pubkey_prepare(const rustsecp256k1_v0_8_1_context* ctx, rustsecp256k1_v0_8_1_prepared_pubkey *prepared, const rustsecp256k1_v0_8_1_pubkey *pubkey) {
+    rustsecp256k1_v0_8_1_ge_storage pre[ECMULT_TABLE_SIZE(ECMULT_PREPARED_WINDOW)];
+    rustsecp256k1_v0_8_1_ge q;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(prepared != NULL);
+    memset(prepared, 0, sizeof(*prepared));
+    ARG_CHECK(pubkey != NULL);
+
+    if (!rustsecp256k1_v0_8_1_pubkey_load(ctx, &q, pubkey)) {
+        return 0;
+    }
+    rustsecp256k1_v0_8_1_ecmult_prepare_table(pre, &q);
+    rustsecp256k1_v0_8_1_prepared_pubkey_save(prepared, pre);
+    return 1;
+}
+
+int rustsecp256k1_v0_8_1_ecdsa_verify_prepared(const rustsecp256k1_v0_8_1_context* ctx, const rustsecp256k1_v0_8_1_ecdsa_signature *sig, const unsigned char *msghash32, const rustsecp256k1_v0_8_1_prepared_pubkey *prepared) {
+    rustsecp256k1_v0_8_1_ge_storage pre[ECMULT_TABLE_SIZE(ECMULT_PREPARED_WINDOW)];
+    rustsecp256k1_v0_8_1_scalar r, s;
+    rustsecp256k1_v0_8_1_scalar m;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(msghash32 != NULL);
+    ARG_CHECK(sig != NULL);
+    ARG_CHECK(prepared != NULL);
+
+    rustsecp256k1_v0_8_1_scalar_set_b32(&m, msghash32, NULL);
+    rustsecp256k1_v0_8_1_ecdsa_signature_load(ctx, &r, &s, sig);
+    return (!rustsecp256k1_v0_8_1_scalar_is_high(&s) &&
+            rustsecp256k1_v0_8_1_prepared_pubkey_load(ctx, pre, prepared) &&
+            rustsecp256k1_v0_8_1_ecdsa_sig_verify_prepared(&r, &s, pre, &m));
+}
+
+/* Number of signatures sharing one scalar inversion when ECDSA signatures are
+ * verified one by one. */
+#define ECDSA_VERIFY_EACH_CHUNK 32
+
+/* Loads signature idx of a batch. Returns 0 if it is invalid regardless of the
+ * message and public key. */
+typedef int (*rustsecp256k1_v0_8_1_ecdsa_batch_load)(const rustsecp256k1_v0_8_1_context* ctx, rustsecp256k1_v0_8_1_scalar *r, rustsecp256k1_v0_8_1_scalar *s, rustsecp256k1_v0_8_1_ge *pubkey, rustsecp256k1_v0_8_1_scalar *message, size_t idx, const void *data);
+
+/* Verifies n_sigs ECDSA signatures one by one, sharing the inversion of the s
+ * values across chunks of signatures. On failure sets *failed_index (if not
+ * NULL) to the index of the first incorrect signature. */
+static int rustsecp256k1_v0_8_1_ecdsa_verify_each_var(const rustsecp256k1_v0_8_1_context* ctx, rustsecp256k1_v0_8_1_ecdsa_batch_load load, const void *data, size_t n_sigs, size_t *failed_index) {
+    rustsecp256k1_v0_8_1_scalar r[ECDSA_VERIFY_EACH_CHUNK];
+    rustsecp256k1_v0_8_1_scalar s[ECDSA_VERIFY_EACH_CHUNK];
+    rustsecp256k1_v0_8_1_scalar sn[ECDSA_VERIFY_EACH_CHUNK];
+    rustsecp256k1_v0_8_1_scalar m[ECDSA_VERIFY_EACH_CHUNK];
+    rustsecp256k1_v0_8_1_ge q[ECDSA_VERIFY_EACH_CHUNK];
+    int valid[ECDSA_VERIFY_EACH_CHUNK];
+    size_t offset;
+    size_t i;
+
+    for (offset = 0; offset < n_sigs; offset += ECDSA_VERIFY_EACH_CHUNK) {
+        size_t len = n_sigs - offset < ECDSA_VERIFY_EACH_CHUNK ? n_sigs - offset : ECDSA_VERIFY_EACH_CHUNK;
+        for (i = 0; i < len; i++) {
+            valid[i] = load(ctx, &r[i], &s[i], &q[i], &m[i], offset + i, data);
+            if (!valid[i]) {
+                /* Keep the batch inversion well-defined. */
+                s[i] = rustsecp256k1_v0_8_1_scalar_one;
+            }
+        }
+        rustsecp256k1_v0_8_1_scalar_inverse_all_var(sn, s, len);
+        for (i = 0; i < len; i++) {
+            if (!valid[i] || !rustsecp256k1_v0_8_1_ecdsa_sig_verify_sinv(&r[i], &sn[i], &q[i], &m[i])) {
+                if (failed_index != NULL) {
+                    *failed_index = offset + i;
+                }
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+typedef struct {
+    const rustsecp256k1_v0_8_1_ecdsa_signature *const *sigs;
+    const unsigned char *const *msghash32;
+    const rustsecp256k1_v0_8_1_pubkey *const *pubkeys;
+} rustsecp256k1_v0_8_1_ecdsa_verify_batch_data;
+
+static int rustsecp256k1_v0_8_1_ecdsa_verify_batch_load(const rustsecp256k1_v0_8_1_context* ctx, rustsecp256k1_v0_8_1_scalar *r, rustsecp256k1_v0_8_1_scalar *s, rustsecp256k1_v0_8_1_ge *pubkey, rustsecp256k1_v0_8_1_scalar *message, size_t idx, const void *data) {
+    const rustsecp256k1_v0_8_1_ecdsa_verify_batch_data *d = (const rustsecp256k1_v0_8_1_ecdsa_verify_batch_data *)data;
+
+    rustsecp256k1_v0_8_1_scalar_set_b32(message, d->msghash32[idx], NULL);
+    rustsecp256k1_v0_8_1_ecdsa_signature_load(ctx, r, s, d->sigs[idx]);
+    return (!rustsecp256k1_v0_8_1_scalar_is_high(s) &&
+            !rustsecp256k1_v0_8_1_scalar_is_zero(s) &&
+            rustsecp256k1_v0_8_1_pubkey_load(ctx, pubkey, d->pubkeys[idx]));
+}
+
+int rustsecp256k1_v0_8_1_ecdsa_verify_batch(const rustsecp256k1_v0_8_1_context* ctx, size_t *failed_index, const rustsecp256k1_v0_8_1_ecdsa_signature *const *sigs, const unsigned char *const *msghash32, const rustsecp256k1_v0_8_1_pubkey *const *pubkeys, size_t n_sigs) {
+    rustsecp256k1_v0_8_1_ecdsa_verify_batch_data data;
+    size_t i;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(n_sigs == 0 || sigs != NULL);
+    ARG_CHECK(n_sigs == 0 || msghash32 != NULL);
+    ARG_CHECK(n_sigs == 0 || pubkeys != NULL);
+    for (i = 0; i < n_sigs; i++) {
+        ARG_CHECK(sigs[i] != NULL);
+        ARG_CHECK(msghash32[i] != NULL);
+        ARG_CHECK(pubkeys[i] != NULL);
+    }
+
+    data.sigs = sigs;
+    data.msghash32 = msghash32;
+    data.pubkeys = pubkeys;
+    return rustsecp256k1_v0_8_1_ecdsa_verify_each_var(ctx, rustsecp256k1_v0_8_1_ecdsa_verify_batch_load, &data, n_sigs, failed_index);
+}
+
 static SECP256K1_INLINE void buffer_append(unsigned char *buf, unsigned int *offset, const void *data, unsigned int len) {
     memcpy(buf + *offset, data, len);
     *offset += len;
@@ -506,6 +815,231 @@ int rustsecp256k1_v0_8_1_ecdsa_sign(const rustsecp256k1_v0_8_1_context* ctx, rus
     return ret;
 }
 
+typedef struct {
+    /* RFC6979 state after the secret key and reduced message, see rfc6979_hmac_sha256_initialize_prefix. */
+    const rustsecp256k1_v0_8_1_hmac_sha256 *prefix;
+    const unsigned char *ndata;
+} rustsecp256k1_v0_8_1_ecdsa_grind_nonce_data;
+
+/* Computes the nonces of nonce_function_rfc6979 with extra data d->ndata, resuming from d->prefix. */
+static int nonce_function_rfc6979_grind(unsigned char *nonce32, const unsigned char *msg32, const unsigned char *key32, const unsigned char *algo16, void *data, unsigned int counter) {
+   const rustsecp256k1_v0_8_1_ecdsa_grind_nonce_data *d = (const rustsecp256k1_v0_8_1_ecdsa_grind_nonce_data *)data;
+   unsigned char keydata[96];
+   unsigned int offset = 0;
+   rustsecp256k1_v0_8_1_rfc6979_hmac_sha256 rng;
+   unsigned int i;
+   rustsecp256k1_v0_8_1_scalar msg;
+   unsigned char msgmod32[32];
+   VERIFY_CHECK(algo16 == NULL);
+   (void)algo16;
+   rustsecp256k1_v0_8_1_scalar_set_b32(&msg, msg32, NULL);
+   rustsecp256k1_v0_8_1_scalar_get_b32(msgmod32, &msg);
+   buffer_append(keydata, &offset, key32, 32);
+   buffer_append(keydata, &offset, msgmod32, 32);
+   if (d->ndata != NULL) {
+       buffer_append(keydata, &offset, d->ndata, 32);
+   }
+   rustsecp256k1_v0_8_1_rfc6979_hmac_sha256_initialize_from(&rng, d->prefix, keydata, offset, 64);
+   memset(keydata, 0, sizeof(keydata));
+   for (i = 0; i <= counter; i++) {
+       rustsecp256k1_v0_8_1_rfc6979_hmac_sha256_generate(&rng, nonce32, 32);
+   }
+   rustsecp256k1_v0_8_1_rfc6979_hmac_sha256_finalize(&rng);
+   return 1;
+}
+
+int rustsecp256k1_v0_8_1_ecdsa_sign_grind(const rustsecp256k1_v0_8_1_context* ctx, rustsecp256k1_v0_8_1_ecdsa_signature *signature, const unsigned char *msghash32, const unsigned char *seckey, rustsecp256k1_v0_8_1_ecdsa_grind_function check, void *data) {
+    rustsecp256k1_v0_8_1_ecdsa_grind_nonce_data nonce_data;
+    rustsecp256k1_v0_8_1_hmac_sha256 prefix;
+    rustsecp256k1_v0_8_1_scalar r, s, msg;
+    unsigned char keydata[64];
+    unsigned char ndata[32] = {0};
+    uint32_t counter;
+    int ret;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(rustsecp256k1_v0_8_1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
+    ARG_CHECK(msghash32 != NULL);
+    ARG_CHECK(signature != NULL);
+    ARG_CHECK(seckey != NULL);
+    ARG_CHECK(check != NULL);
+
+    /* The secret key and reduced message start the key of every attempt. */
+    memcpy(keydata, seckey, 32);
+    rustsecp256k1_v0_8_1_scalar_set_b32(&msg, msghash32, NULL);
+    rustsecp256k1_v0_8_1_scalar_get_b32(&keydata[32], &msg);
+    rustsecp256k1_v0_8_1_rfc6979_hmac_sha256_initialize_prefix(&prefix, keydata, sizeof(keydata));
+    memset(keydata, 0, sizeof(keydata));
+    nonce_data.prefix = &prefix;
+    nonce_data.ndata = NULL;
+
+    for (counter = 0; ; counter++) {
+        if (counter > 0) {
+            ndata[0] = counter & 0xff;
+            ndata[1] = (counter >> 8) & 0xff;
+            ndata[2] = (counter >> 16) & 0xff;
+            ndata[3] = counter >> 24;
+            nonce_data.ndata = ndata;
+        }
+        ret = rustsecp256k1_v0_8_1_ecdsa_sign_inner(ctx, &r, &s, NULL, msghash32, seckey, nonce_function_rfc6979_grind, &nonce_data);
+        rustsecp256k1_v0_8_1_ecdsa_signature_save(signature, &r, &s);
+        if (!ret || check(signature, data)) {
+            break;
+        }
+    }
+    memset(&prefix, 0, sizeof(prefix));
+    return ret;
+}
+
+/* Number of signatures sharing one scalar and one field inversion in ecdsa_sign_batch. */
+#define ECDSA_SIGN_BATCH_CHUNK 64
+
+int rustsecp256k1_v0_8_1_ecdsa_sign_batch(const rustsecp256k1_v0_8_1_context* ctx, rustsecp256k1_v0_8_1_ecdsa_signature *signatures, const unsigned char *const *msghash32, const unsigned char *const *seckeys, size_t n) {
+    rustsecp256k1_v0_8_1_scalar sec[ECDSA_SIGN_BATCH_CHUNK];
+    rustsecp256k1_v0_8_1_scalar non[ECDSA_SIGN_BATCH_CHUNK];
+    rustsecp256k1_v0_8_1_scalar noninv[ECDSA_SIGN_BATCH_CHUNK];
+    rustsecp256k1_v0_8_1_gej rj[ECDSA_SIGN_BATCH_CHUNK];
+    rustsecp256k1_v0_8_1_ge r[ECDSA_SIGN_BATCH_CHUNK];
+    int is_sec_valid[ECDSA_SIGN_BATCH_CHUNK];
+    int is_nonce_valid[ECDSA_SIGN_BATCH_CHUNK];
+    unsigned char nonce32[32];
+    unsigned char b[32];
+    int ret = 1;
+    size_t offset;
+    size_t i;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(rustsecp256k1_v0_8_1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
+    ARG_CHECK(n == 0 || signatures != NULL);
+    ARG_CHECK(n == 0 || msghash32 != NULL);
+    ARG_CHECK(n == 0 || seckeys != NULL);
+    for (i = 0; i < n; i++) {
+        ARG_CHECK(msghash32[i] != NULL);
+        ARG_CHECK(seckeys[i] != NULL);
+    }
+
+    for (offset = 0; offset < n; offset += ECDSA_SIGN_BATCH_CHUNK) {
+        size_t len = n - offset < ECDSA_SIGN_BATCH_CHUNK ? n - offset : ECDSA_SIGN_BATCH_CHUNK;
+
+        /* The first nonce of each signature, exactly as ecdsa_sign with the default nonce function. */
+        for (i = 0; i < len; i++) {
+            is_sec_valid[i] = rustsecp256k1_v0_8_1_scalar_set_b32_seckey(&sec[i], seckeys[offset + i]);
+            rustsecp256k1_v0_8_1_scalar_cmov(&sec[i], &rustsecp256k1_v0_8_1_scalar_one, !is_sec_valid[i]);
+            nonce_function_rfc6979(nonce32, msghash32[offset + i], seckeys[offset + i], NULL, NULL, 0);
+            is_nonce_valid[i] = rustsecp256k1_v0_8_1_scalar_set_b32_seckey(&non[i], nonce32);
+            rustsecp256k1_v0_8_1_declassify(ctx, &is_nonce_valid[i], sizeof(is_nonce_valid[i]));
+            /* Keeps the shared inversions well defined, the signature is redone below. */
+            rustsecp256k1_v0_8_1_scalar_cmov(&non[i], &rustsecp256k1_v0_8_1_scalar_one, !is_nonce_valid[i]);
+            rustsecp256k1_v0_8_1_ecmult_gen(&ctx->ecmult_gen_ctx, &rj[i], &non[i]);
+        }
+        rustsecp256k1_v0_8_1_ge_set_all_gej(r, rj, len);
+        rustsecp256k1_v0_8_1_scalar_inverse_all(noninv, non, len);
+
+        /* s = k^-1 (m + r * x) as in ecdsa_sig_sign. */
+        for (i = 0; i < len; i++) {
+            rustsecp256k1_v0_8_1_scalar sigr, sigs, msg, t;
+            int ok;
+            rustsecp256k1_v0_8_1_fe_normalize(&r[i].x);
+            rustsecp256k1_v0_8_1_fe_get_b32(b, &r[i].x);
+            rustsecp256k1_v0_8_1_scalar_set_b32(&sigr, b, NULL);
+            rustsecp256k1_v0_8_1_scalar_set_b32(&msg, msghash32[offset + i], NULL);
+            rustsecp256k1_v0_8_1_scalar_mul(&t, &sigr, &sec[i]);
+            rustsecp256k1_v0_8_1_scalar_add(&t, &t, &msg);
+            rustsecp256k1_v0_8_1_scalar_mul(&sigs, &noninv[i], &t);
+            rustsecp256k1_v0_8_1_scalar_cond_negate(&sigs, rustsecp256k1_v0_8_1_scalar_is_high(&sigs));
+            ok = is_nonce_valid[i] & !rustsecp256k1_v0_8_1_scalar_is_zero(&sigr) & !rustsecp256k1_v0_8_1_scalar_is_zero(&sigs);
+            rustsecp256k1_v0_8_1_declassify(ctx, &ok, sizeof(ok));
+            if (!ok) {
+                /* The next nonce is needed, which is cryptographically unreachable. */
+                ok = rustsecp256k1_v0_8_1_ecdsa_sign_inner(ctx, &sigr, &sigs, NULL, msghash32[offset + i], seckeys[offset + i], NULL, NULL);
+            } else {
+                ok &= is_sec_valid[i];
+                rustsecp256k1_v0_8_1_scalar_cmov(&sigr, &rustsecp256k1_v0_8_1_scalar_zero, !ok);
+                rustsecp256k1_v0_8_1_scalar_cmov(&sigs, &rustsecp256k1_v0_8_1_scalar_zero, !ok);
+            }
+            rustsecp256k1_v0_8_1_ecdsa_signature_save(&signatures[offset + i], &sigr, &sigs);
+            rustsecp256k1_v0_8_1_scalar_clear(&t);
+            ret &= ok;
+        }
+    }
+
+    memset(nonce32, 0, sizeof(nonce32));
+    memset(sec, 0, sizeof(sec));
+    memset(non, 0, sizeof(non));
+    memset(noninv, 0, sizeof(noninv));
+    memset(rj, 0, sizeof(rj));
+    memset(r, 0, sizeof(r));
+    return ret;
+}
+
+int rustsecp256k1_v0_8_1_ecdsa_presignature_create(const rustsecp256k1_v0_8_1_context* ctx, rustsecp256k1_v0_8_1_ecdsa_presignature *presig, const unsigned char *nonce32) {
+    rustsecp256k1_v0_8_1_scalar non, noninv, sigr;
+    rustsecp256k1_v0_8_1_gej rj;
+    rustsecp256k1_v0_8_1_ge r;
+    unsigned char b[32];
+    int ret;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(rustsecp256k1_v0_8_1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
+    ARG_CHECK(presig != NULL);
+    ARG_CHECK(nonce32 != NULL);
+
+    /* The nonce dependent part of ecdsa_sig_sign: r = (k*G).x and k^-1. */
+    ret = rustsecp256k1_v0_8_1_scalar_set_b32_seckey(&non, nonce32);
+    rustsecp256k1_v0_8_1_scalar_cmov(&non, &rustsecp256k1_v0_8_1_scalar_one, !ret);
+    rustsecp256k1_v0_8_1_ecmult_gen(&ctx->ecmult_gen_ctx, &rj, &non);
+    rustsecp256k1_v0_8_1_ge_set_gej(&r, &rj);
+    rustsecp256k1_v0_8_1_fe_normalize(&r.x);
+    rustsecp256k1_v0_8_1_fe_get_b32(b, &r.x);
+    rustsecp256k1_v0_8_1_scalar_set_b32(&sigr, b, NULL);
+    ret &= !rustsecp256k1_v0_8_1_scalar_is_zero(&sigr);
+    rustsecp256k1_v0_8_1_scalar_inverse(&noninv, &non);
+
+    /* An all zero presignature is rejected by ecdsa_sign_with_presignature. */
+    rustsecp256k1_v0_8_1_scalar_cmov(&noninv, &rustsecp256k1_v0_8_1_scalar_zero, !ret);
+    rustsecp256k1_v0_8_1_scalar_cmov(&sigr, &rustsecp256k1_v0_8_1_scalar_zero, !ret);
+    rustsecp256k1_v0_8_1_scalar_get_b32(&presig->data[0], &noninv);
+    rustsecp256k1_v0_8_1_scalar_get_b32(&presig->data[32], &sigr);
+
+    rustsecp256k1_v0_8_1_scalar_clear(&non);
+    rustsecp256k1_v0_8_1_scalar_clear(&noninv);
+    rustsecp256k1_v0_8_1_gej_clear(&rj);
+    rustsecp256k1_v0_8_1_ge_clear(&r);
+    return ret;
+}
+
+int rustsecp256k1_v0_8_1_ecdsa_sign_with_presignature(const rustsecp256k1_v0_8_1_context* ctx, rustsecp256k1_v0_8_1_ecdsa_signature *signature, const unsigned char *msghash32, const unsigned char *seckey, rustsecp256k1_v0_8_1_ecdsa_presignature *presig) {
+    rustsecp256k1_v0_8_1_scalar sec, noninv, sigr, sigs, msg;
+    int ret;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(signature != NULL);
+    ARG_CHECK(msghash32 != NULL);
+    ARG_CHECK(seckey != NULL);
+    ARG_CHECK(presig != NULL);
+
+    ret = rustsecp256k1_v0_8_1_scalar_set_b32_seckey(&sec, seckey);
+    ret &= rustsecp256k1_v0_8_1_scalar_set_b32_seckey(&noninv, &presig->data[0]);
+    ret &= rustsecp256k1_v0_8_1_scalar_set_b32_seckey(&sigr, &presig->data[32]);
+    /* The presignature is single use, whether or not it was valid. */
+    memset(presig, 0, sizeof(*presig));
+
+    /* s = k^-1 (m + r * x) as in ecdsa_sig_sign. */
+    rustsecp256k1_v0_8_1_scalar_set_b32(&msg, msghash32, NULL);
+    rustsecp256k1_v0_8_1_scalar_mul(&sigs, &sigr, &sec);
+    rustsecp256k1_v0_8_1_scalar_add(&sigs, &sigs, &msg);
+    rustsecp256k1_v0_8_1_scalar_mul(&sigs, &noninv, &sigs);
+    rustsecp256k1_v0_8_1_scalar_cond_negate(&sigs, rustsecp256k1_v0_8_1_scalar_is_high(&sigs));
+    ret &= !rustsecp256k1_v0_8_1_scalar_is_zero(&sigs);
+    rustsecp256k1_v0_8_1_scalar_cmov(&sigr, &rustsecp256k1_v0_8_1_scalar_zero, !ret);
+    rustsecp256k1_v0_8_1_scalar_cmov(&sigs, &rustsecp256k1_v0_8_1_scalar_zero, !ret);
+    rustsecp256k1_v0_8_1_ecdsa_signature_save(signature, &sigr, &sigs);
+
+    rustsecp256k1_v0_8_1_scalar_clear(&sec);
+    rustsecp256k1_v0_8_1_scalar_clear(&noninv);
+    rustsecp256k1_v0_8_1_scalar_clear(&msg);
+    return ret;
+}
+
 int rustsecp256k1_v0_8_1_ec_seckey_verify(const rustsecp256k1_v0_8_1_context* ctx, const unsigned char *seckey) {
     rustsecp256k1_v0_8_1_scalar sec;
     int ret;
@@ -547,6 +1081,47 @@ int rustsecp256k1_v0_8_1_ec_pubkey_create(const rustsecp256k1_v0_8_1_context* ct
     return ret;
 }
 
+/* Number of public keys sharing one field inversion in ec_pubkey_create_batch. */
+#define EC_PUBKEY_CREATE_BATCH_CHUNK 64
+
+int rustsecp256k1_v0_8_1_ec_pubkey_create_batch(const rustsecp256k1_v0_8_1_context* ctx, rustsecp256k1_v0_8_1_pubkey *pubkeys, const unsigned char *const *seckeys, size_t n) {
+    rustsecp256k1_v0_8_1_gej pj[EC_PUBKEY_CREATE_BATCH_CHUNK];
+    rustsecp256k1_v0_8_1_ge p[EC_PUBKEY_CREATE_BATCH_CHUNK];
+    int valid[EC_PUBKEY_CREATE_BATCH_CHUNK];
+    rustsecp256k1_v0_8_1_scalar seckey_scalar;
+    size_t offset;
+    size_t i;
+    int ret = 1;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(n == 0 || pubkeys != NULL);
+    if (n > 0) {
+        memset(pubkeys, 0, sizeof(*pubkeys) * n);
+    }
+    ARG_CHECK(rustsecp256k1_v0_8_1_ecmult_gen_context_is_built(&ctx->ecmult_gen_ctx));
+    ARG_CHECK(n == 0 || seckeys != NULL);
+    for (i = 0; i < n; i++) {
+        ARG_CHECK(seckeys[i] != NULL);
+    }
+
+    for (offset = 0; offset < n; offset += EC_PUBKEY_CREATE_BATCH_CHUNK) {
+        size_t len = n - offset < EC_PUBKEY_CREATE_BATCH_CHUNK ? n - offset : EC_PUBKEY_CREATE_BATCH_CHUNK;
+        for (i = 0; i < len; i++) {
+            valid[i] = rustsecp256k1_v0_8_1_scalar_set_b32_seckey(&seckey_scalar, seckeys[offset + i]);
+            rustsecp256k1_v0_8_1_scalar_cmov(&seckey_scalar, &rustsecp256k1_v0_8_1_scalar_one, !valid[i]);
+            rustsecp256k1_v0_8_1_ecmult_gen(&ctx->ecmult_gen_ctx, &pj[i], &seckey_scalar);
+            ret &= valid[i];
+        }
+        rustsecp256k1_v0_8_1_ge_set_all_gej(p, pj, len);
+        for (i = 0; i < len; i++) {
+            rustsecp256k1_v0_8_1_pubkey_save(&pubkeys[offset + i], &p[i]);
+            rustsecp256k1_v0_8_1_memczero(&pubkeys[offset + i], sizeof(pubkeys[offset + i]), !valid[i]);
+        }
+    }
+
+    rustsecp256k1_v0_8_1_scalar_clear(&seckey_scalar);
+    return ret;
+}
+
 int rustsecp256k1_v0_8_1_ec_seckey_negate(const rustsecp256k1_v0_8_1_context* ctx, unsigned char *seckey) {
     rustsecp256k1_v0_8_1_scalar sec;
     int ret = 0;
@@ -718,6 +1293,50 @@ int rustsecp256k1_v0_8_1_ec_pubkey_combine(const rustsecp256k1_v0_8_1_context* c
     return 1;
 }
 
+/* Number of public keys sharing one field inversion in ec_pubkey_range. */
+#define EC_PUBKEY_RANGE_CHUNK 64
+
+int rustsecp256k1_v0_8_1_ec_pubkey_range(const rustsecp256k1_v0_8_1_context* ctx, rustsecp256k1_v0_8_1_pubkey *pubkeys, rustsecp256k1_v0_8_1_pubkey *next, const rustsecp256k1_v0_8_1_pubkey *step, size_t n) {
+    rustsecp256k1_v0_8_1_gej pj[EC_PUBKEY_RANGE_CHUNK + 1];
+    rustsecp256k1_v0_8_1_ge p[EC_PUBKEY_RANGE_CHUNK + 1];
+    rustsecp256k1_v0_8_1_ge s;
+    size_t offset;
+    size_t len;
+    size_t i;
+
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(n == 0 || pubkeys != NULL);
+    ARG_CHECK(next != NULL);
+    ARG_CHECK(step != NULL);
+
+    if (!rustsecp256k1_v0_8_1_pubkey_load(ctx, &p[0], next) || !rustsecp256k1_v0_8_1_pubkey_load(ctx, &s, step)) {
+        return 0;
+    }
+    len = 0;
+    for (offset = 0; offset < n; offset += len) {
+        len = n - offset < EC_PUBKEY_RANGE_CHUNK ? n - offset : EC_PUBKEY_RANGE_CHUNK;
+        /* p[0] is the first public key of the chunk, the last one computed is the first
+         * public key of the next chunk. */
+        rustsecp256k1_v0_8_1_gej_set_ge(&pj[0], &p[0]);
+        for (i = 0; i < len; i++) {
+            rustsecp256k1_v0_8_1_gej_add_ge_var(&pj[i + 1], &pj[i], &s, NULL);
+        }
+        rustsecp256k1_v0_8_1_ge_set_all_gej_var(p, pj, len + 1);
+        for (i = 0; i <= len; i++) {
+            if (rustsecp256k1_v0_8_1_ge_is_infinity(&p[i])) {
+                memset(pubkeys, 0, sizeof(*pubkeys) * n);
+                return 0;
+            }
+        }
+        for (i = 0; i < len; i++) {
+            rustsecp256k1_v0_8_1_pubkey_save(&pubkeys[offset + i], &p[i]);
+        }
+        p[0] = p[len];
+    }
+    rustsecp256k1_v0_8_1_pubkey_save(next, &p[0]);
+    return 1;
+}
+
 int rustsecp256k1_v0_8_1_tagged_sha256(const rustsecp256k1_v0_8_1_context* ctx, unsigned char *hash32, const unsigned char *tag, size_t taglen, const unsigned char *msg, size_t msglen) {
     rustsecp256k1_v0_8_1_sha256 sha;
     VERIFY_CHECK(ctx != NULL);
@@ -731,6 +1350,40 @@ int rustsecp256k1_v0_8_1_tagged_sha256(const rustsecp256k1_v0_8_1_context* ctx,
     return 1;
 }
 
+int rustsecp256k1_v0_8_1_tagged_sha256_midstate(const rustsecp256k1_v0_8_1_context* ctx, unsigned char *midstate32, const unsigned char *tag, size_t taglen) {
+    rustsecp256k1_v0_8_1_sha256 sha;
+    int i;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(midstate32 != NULL);
+    ARG_CHECK(tag != NULL);
+
+    rustsecp256k1_v0_8_1_sha256_initialize_tagged(&sha, tag, taglen);
+    /* Both tag hashes fill exactly one block, so the state is all there is. */
+    VERIFY_CHECK(sha.bytes == 64);
+    for (i = 0; i < 8; i++) {
+        rustsecp256k1_v0_8_1_write_be32(&midstate32[4 * i], sha.s[i]);
+    }
+    return 1;
+}
+
+int rustsecp256k1_v0_8_1_tagged_sha256_from_midstate(const rustsecp256k1_v0_8_1_context* ctx, unsigned char *hash32, const unsigned char *midstate32, const unsigned char *msg, size_t msglen) {
+    rustsecp256k1_v0_8_1_sha256 sha;
+    int i;
+    VERIFY_CHECK(ctx != NULL);
+    ARG_CHECK(hash32 != NULL);
+    ARG_CHECK(midstate32 != NULL);
+    ARG_CHECK(msg != NULL);
+
+    rustsecp256k1_v0_8_1_sha256_initialize(&sha);
+    for (i = 0; i < 8; i++) {
+        sha.s[i] = rustsecp256k1_v0_8_1_read_be32(&midstate32[4 * i]);
+    }
+    sha.bytes = 64;
+    rustsecp256k1_v0_8_1_sha256_write(&sha, msg, msglen);
+    rustsecp256k1_v0_8_1_sha256_finalize(&sha, hash32);
+    return 1;
+}
+
 #ifdef ENABLE_MODULE_ECDH
 # include "modules/ecdh/main_impl.h"
 #endif
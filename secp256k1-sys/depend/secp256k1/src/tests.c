@@ -594,6 +594,78 @@ void run_sha256_counter_tests(void) {
     }
 }
 
+/* Each SHA-256 transform the CPU supports is compared with the portable one directly, so that all
+ * of them are tested whichever one the dispatch prefers. */
+void run_sha256_transform_tests(void) {
+    rustsecp256k1_v0_8_1_sha256 hash[8], lanes[8];
+    uint32_t expected[8][8];
+    int i, j, k;
+    for (i = 0; i < count; i++) {
+        for (k = 0; k < 8; k++) {
+            for (j = 0; j < 8; j++) {
+                hash[k].s[j] = rustsecp256k1_v0_8_1_testrand32();
+            }
+            rustsecp256k1_v0_8_1_testrand_bytes_test(hash[k].buf, 64);
+            hash[k].bytes = 64;
+            memcpy(expected[k], hash[k].s, sizeof(expected[k]));
+            rustsecp256k1_v0_8_1_sha256_transform_portable(expected[k], hash[k].buf);
+        }
+#if defined(USE_SHA_NI_DISPATCH)
+        if (rustsecp256k1_v0_8_1_have_sha_ni()) {
+            for (k = 0; k < 8; k++) {
+                lanes[k] = hash[k];
+                rustsecp256k1_v0_8_1_sha256_transform_shani(lanes[k].s, lanes[k].buf);
+                CHECK(memcmp(lanes[k].s, expected[k], sizeof(expected[k])) == 0);
+            }
+        }
+#endif
+#if defined(USE_AVX2_DISPATCH)
+        if (rustsecp256k1_v0_8_1_have_avx2()) {
+            memcpy(lanes, hash, sizeof(lanes));
+            rustsecp256k1_v0_8_1_sha256_transform_x8_avx2(lanes);
+            for (k = 0; k < 8; k++) {
+                CHECK(memcmp(lanes[k].s, expected[k], sizeof(expected[k])) == 0);
+            }
+        }
+#endif
+        memcpy(lanes, hash, sizeof(lanes));
+        rustsecp256k1_v0_8_1_sha256_transform_x8(lanes);
+        for (k = 0; k < 8; k++) {
+            CHECK(memcmp(lanes[k].s, expected[k], sizeof(expected[k])) == 0);
+        }
+    }
+}
+
+/* Hashing eight messages at once agrees with hashing them one at a time, for every length up to
+ * three blocks, written in two parts split at a random point. */
+void run_sha256_x8_tests(void) {
+    rustsecp256k1_v0_8_1_sha256 hash[8];
+    unsigned char msg[8][192], out[8][32], expected[32];
+    const unsigned char *data[8];
+    size_t len, split;
+    int k;
+    for (len = 0; len <= sizeof(msg[0]); len++) {
+        split = rustsecp256k1_v0_8_1_testrand_int(len + 1);
+        for (k = 0; k < 8; k++) {
+            rustsecp256k1_v0_8_1_testrand_bytes_test(msg[k], len);
+            rustsecp256k1_v0_8_1_sha256_initialize(&hash[k]);
+            data[k] = msg[k];
+        }
+        rustsecp256k1_v0_8_1_sha256_write_x8(hash, data, split);
+        for (k = 0; k < 8; k++) {
+            data[k] = msg[k] + split;
+        }
+        rustsecp256k1_v0_8_1_sha256_write_x8(hash, data, len - split);
+        rustsecp256k1_v0_8_1_sha256_finalize_x8(hash, out[0]);
+        for (k = 0; k < 8; k++) {
+            rustsecp256k1_v0_8_1_sha256_initialize(&hash[k]);
+            rustsecp256k1_v0_8_1_sha256_write(&hash[k], msg[k], len);
+            rustsecp256k1_v0_8_1_sha256_finalize(&hash[k], expected);
+            CHECK(rustsecp256k1_v0_8_1_memcmp_var(out[k], expected, 32) == 0);
+        }
+    }
+}
+
 void run_hmac_sha256_tests(void) {
     static const char *keys[6] = {
         "\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b",
@@ -3938,6 +4010,119 @@ void run_group_decompress(void) {
     }
 }
 
+/* Adds d, which may be negative, to the big endian 256-bit number b32, modulo 2^256. */
+void add_int_b32(unsigned char *b32, int d) {
+    int i, v, lo;
+    for (i = 31; i >= 0 && d != 0; i--) {
+        v = b32[i] + d;
+        lo = ((v % 256) + 256) % 256;
+        b32[i] = lo;
+        d = (v - lo) / 256;
+    }
+}
+
+/* Sets b32 to a random x coordinate for the decompression tests: an arbitrary 256-bit value, one
+ * at or just below a limb boundary of field_10x26.h or field_5x52.h, one close to p or 2^256, the x
+ * of a point, or an x that is not on the curve. */
+void random_x_b32(unsigned char *b32) {
+    static const unsigned char p_b32[32] = {
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0x2f
+    };
+    rustsecp256k1_v0_8_1_fe fe;
+    rustsecp256k1_v0_8_1_ge ge;
+    int bit;
+    switch (rustsecp256k1_v0_8_1_testrand_int(5)) {
+    case 0:
+        rustsecp256k1_v0_8_1_testrand256_test(b32);
+        break;
+    case 1:
+        /* 2^bit or 2^bit - 1, for bit a multiple of 26 or 52, or 255. */
+        bit = rustsecp256k1_v0_8_1_testrand_int(2) ? 26 * (1 + rustsecp256k1_v0_8_1_testrand_int(9)) : 52 * (1 + rustsecp256k1_v0_8_1_testrand_int(4));
+        if (rustsecp256k1_v0_8_1_testrand_int(4) == 0) {
+            bit = 255;
+        }
+        memset(b32, 0, 32);
+        b32[31 - bit / 8] = 1 << (bit % 8);
+        add_int_b32(b32, -(int)rustsecp256k1_v0_8_1_testrand_int(2));
+        break;
+    case 2:
+        /* p - 2 to p + 2, or 2^256 - 3 to 2^256 - 1. */
+        if (rustsecp256k1_v0_8_1_testrand_int(2)) {
+            memcpy(b32, p_b32, 32);
+            add_int_b32(b32, 2 - (int)rustsecp256k1_v0_8_1_testrand_int(5));
+        } else {
+            memset(b32, 0, 32);
+            add_int_b32(b32, -1 - (int)rustsecp256k1_v0_8_1_testrand_int(3));
+        }
+        break;
+    case 3:
+        random_group_element_test(&ge);
+        rustsecp256k1_v0_8_1_fe_normalize_var(&ge.x);
+        rustsecp256k1_v0_8_1_fe_get_b32(b32, &ge.x);
+        break;
+    default:
+        do {
+            random_fe_test(&fe);
+        } while (rustsecp256k1_v0_8_1_ge_set_xo_var(&ge, &fe, 0));
+        rustsecp256k1_v0_8_1_fe_get_b32(b32, &fe);
+        break;
+    }
+}
+
+#if defined(USE_AVX2_DISPATCH)
+/* Each lane of fe_sqrt_x4 agrees with fe_sqrt, for inputs of every magnitude fe_sqrt accepts. */
+void run_sqrt_x4(void) {
+    rustsecp256k1_v0_8_1_fe a[4], r[4], r1;
+    int ret[4], i, k;
+    unsigned char b32[32];
+    if (!rustsecp256k1_v0_8_1_have_avx2()) {
+        return;
+    }
+    for (i = 0; i < count * 4; i++) {
+        for (k = 0; k < 4; k++) {
+            random_x_b32(b32);
+            /* A value of at least p is loaded as a non-normalized element. */
+            rustsecp256k1_v0_8_1_fe_set_b32(&a[k], b32);
+            random_field_element_magnitude(&a[k]);
+        }
+        rustsecp256k1_v0_8_1_fe_sqrt_x4(r, ret, a);
+        for (k = 0; k < 4; k++) {
+            CHECK(ret[k] == rustsecp256k1_v0_8_1_fe_sqrt(&r1, &a[k]));
+            CHECK(check_fe_equal(&r[k], &r1));
+        }
+    }
+}
+
+/* Each lane of ge_set_xo_var_x4 agrees with ge_set_xo_var. */
+void run_group_decompress_x4(void) {
+    rustsecp256k1_v0_8_1_fe x[4];
+    rustsecp256k1_v0_8_1_ge r[4], r1;
+    int ret[4], odd[4], i, k;
+    unsigned char b32[32];
+    if (!rustsecp256k1_v0_8_1_have_avx2()) {
+        return;
+    }
+    for (i = 0; i < count * 4; i++) {
+        for (k = 0; k < 4; k++) {
+            random_x_b32(b32);
+            rustsecp256k1_v0_8_1_fe_set_b32(&x[k], b32);
+            rustsecp256k1_v0_8_1_fe_normalize_var(&x[k]);
+            odd[k] = rustsecp256k1_v0_8_1_testrand_int(2);
+        }
+        rustsecp256k1_v0_8_1_ge_set_xo_var_x4(r, ret, x, odd);
+        for (k = 0; k < 4; k++) {
+            CHECK(ret[k] == rustsecp256k1_v0_8_1_ge_set_xo_var(&r1, &x[k], odd[k]));
+            if (ret[k]) {
+                rustsecp256k1_v0_8_1_fe_normalize_var(&r[k].y);
+                rustsecp256k1_v0_8_1_fe_normalize_var(&r1.y);
+                ge_equals_ge(&r[k], &r1);
+            }
+        }
+    }
+}
+#endif
+
 /***** ECMULT TESTS *****/
 
 void test_pre_g_table(const rustsecp256k1_v0_8_1_ge_storage * pre_g, size_t n) {
@@ -5831,6 +6016,32 @@ void run_ec_pubkey_parse_test(void) {
     }
 }
 
+/* ec_pubkey_parse_batch agrees with ec_pubkey_parse on every key, for batches of every length
+ * modulo four (which the AVX2 decompression works in), mixing in keys with an invalid tag. */
+void run_ec_pubkey_parse_batch_test(void) {
+    unsigned char input[13][33];
+    const unsigned char *inputs[13];
+    rustsecp256k1_v0_8_1_pubkey pubkeys[13], pubkey;
+    size_t n, k;
+    int i, ret, all;
+    for (i = 0; i < count; i++) {
+        for (n = 0; n <= 13; n++) {
+            for (k = 0; k < n; k++) {
+                input[k][0] = rustsecp256k1_v0_8_1_testrand_int(8) == 0 ? 0x04 + rustsecp256k1_v0_8_1_testrand_int(4) : 0x02 + rustsecp256k1_v0_8_1_testrand_int(2);
+                random_x_b32(&input[k][1]);
+                inputs[k] = input[k];
+            }
+            ret = rustsecp256k1_v0_8_1_ec_pubkey_parse_batch(ctx, pubkeys, inputs, 33, n);
+            all = 1;
+            for (k = 0; k < n; k++) {
+                all &= rustsecp256k1_v0_8_1_ec_pubkey_parse(ctx, &pubkey, inputs[k], 33);
+                CHECK(rustsecp256k1_v0_8_1_memcmp_var(&pubkey, &pubkeys[k], sizeof(pubkey)) == 0);
+            }
+            CHECK(ret == all);
+        }
+    }
+}
+
 void run_eckey_edge_case_test(void) {
     const unsigned char orderc[32] = {
         0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
@@ -7387,6 +7598,8 @@ int main(int argc, char **argv) {
 
     run_sha256_known_output_tests();
     run_sha256_counter_tests();
+    run_sha256_transform_tests();
+    run_sha256_x8_tests();
     run_hmac_sha256_tests();
     run_rfc6979_hmac_sha256_tests();
     run_tagged_sha256_tests();
@@ -7401,11 +7614,17 @@ int main(int argc, char **argv) {
     run_fe_mul();
     run_sqr();
     run_sqrt();
+#if defined(USE_AVX2_DISPATCH)
+    run_sqrt_x4();
+#endif
 
     /* group tests */
     run_ge();
     run_gej();
     run_group_decompress();
+#if defined(USE_AVX2_DISPATCH)
+    run_group_decompress_x4();
+#endif
 
     /* ecmult tests */
     run_ecmult_pre_g();
@@ -7424,6 +7643,7 @@ int main(int argc, char **argv) {
 
     /* EC point parser test */
     run_ec_pubkey_parse_test();
+    run_ec_pubkey_parse_batch_test();
 
     /* EC key edge cases */
     run_eckey_edge_case_test();
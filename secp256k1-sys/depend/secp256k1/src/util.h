@@ -326,4 +326,68 @@ SECP256K1_INLINE static void rustsecp256k1_v0_8_1_write_be32(unsigned char* p, u
     p[0] = x >> 24;
 }
 
+#if defined(USE_SHA_NI_DISPATCH) || defined(USE_AVX2_DISPATCH)
+/* Execute CPUID with the given leaf and subleaf 0, returning 0 if the leaf is not supported.
+ * CPUID is slow, and traps to the hypervisor in virtual machines, so callers run it once from a
+ * load time constructor and cache the answer. */
+static int rustsecp256k1_v0_8_1_cpuid(uint32_t leaf, uint32_t *ebx, uint32_t *ecx) {
+    uint32_t eax, edx;
+    __asm__ __volatile__ ("cpuid" : "=a"(eax), "=b"(*ebx), "=c"(*ecx), "=d"(edx) : "a"(0), "c"(0));
+    if (eax < leaf) {
+        return 0;
+    }
+    __asm__ __volatile__ ("cpuid" : "=a"(eax), "=b"(*ebx), "=c"(*ecx), "=d"(edx) : "a"(leaf), "c"(0));
+    return 1;
+}
+#endif
+
+#if defined(USE_SHA_NI_DISPATCH)
+/* Whether the CPU supports the SHA extensions and SSE4.1, used by the SHA-256 transform selected
+ * at runtime when USE_SHA_NI_DISPATCH is defined. Written only by the constructor below, which
+ * runs when the library is loaded, before any thread can call into it; until then the portable
+ * transform is used. */
+static int rustsecp256k1_v0_8_1_have_sha_ni_flag = 0;
+
+static void __attribute__((constructor)) rustsecp256k1_v0_8_1_detect_sha_ni(void) {
+    uint32_t ebx, ecx;
+    int have;
+    if (rustsecp256k1_v0_8_1_cpuid(7, &ebx, &ecx)) {
+        /* CPUID.(EAX=7,ECX=0):EBX bit 29 is SHA. */
+        have = (ebx >> 29) & 1;
+        rustsecp256k1_v0_8_1_cpuid(1, &ebx, &ecx);
+        /* CPUID.(EAX=1):ECX bit 9 is SSSE3, bit 19 is SSE4.1. */
+        rustsecp256k1_v0_8_1_have_sha_ni_flag = have && ((ecx >> 9) & 1) && ((ecx >> 19) & 1);
+    }
+}
+
+static int rustsecp256k1_v0_8_1_have_sha_ni(void) {
+    return rustsecp256k1_v0_8_1_have_sha_ni_flag;
+}
+#endif
+
+#if defined(USE_AVX2_DISPATCH)
+/* Whether the CPU supports AVX2 and the operating system saves the AVX registers, for the
+ * eight-lane SHA-256 transform and the four-lane field arithmetic selected at runtime when
+ * USE_AVX2_DISPATCH is defined. Written only by the constructor below, like have_sha_ni, so
+ * that concurrent batch verifications never race on it. */
+static int rustsecp256k1_v0_8_1_have_avx2_flag = 0;
+
+static void __attribute__((constructor)) rustsecp256k1_v0_8_1_detect_avx2(void) {
+    uint32_t ebx, ecx, xcr0, edx;
+    /* CPUID.(EAX=1):ECX bit 27 is OSXSAVE, bit 28 is AVX. */
+    if (rustsecp256k1_v0_8_1_cpuid(1, &ebx, &ecx) && ((ecx >> 27) & 1) && ((ecx >> 28) & 1)) {
+        /* XCR0 bit 1 is SSE state, bit 2 is AVX state. */
+        __asm__ __volatile__ ("xgetbv" : "=a"(xcr0), "=d"(edx) : "c"(0));
+        if ((xcr0 & 6) == 6 && rustsecp256k1_v0_8_1_cpuid(7, &ebx, &ecx)) {
+            /* CPUID.(EAX=7,ECX=0):EBX bit 5 is AVX2. */
+            rustsecp256k1_v0_8_1_have_avx2_flag = (ebx >> 5) & 1;
+        }
+    }
+}
+
+static int rustsecp256k1_v0_8_1_have_avx2(void) {
+    return rustsecp256k1_v0_8_1_have_avx2_flag;
+}
+#endif
+
 #endif /* SECP256K1_UTIL_H */
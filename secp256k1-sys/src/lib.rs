@@ -70,6 +70,13 @@ pub type NonceFn = Option<unsafe extern "C" fn(
     attempt: c_uint,
 ) -> c_int>;
 
+/// Function deciding whether `secp256k1_ecdsa_sign_grind` accepts a
+/// signature (returning 1) or tries the next nonce (returning 0).
+pub type EcdsaGrindFn = Option<unsafe extern "C" fn(
+    sig: *const Signature,
+    data: *mut c_void,
+) -> c_int>;
+
 /// Hash function to use to post-process an ECDH point to get
 /// a shared secret.
 pub type EcdhHashFn = Option<unsafe extern "C" fn(
@@ -130,6 +137,12 @@ impl SchnorrSigExtraParams {
 #[derive(Clone, Debug)]
 #[repr(C)] pub struct Context(c_int);
 
+/// A Secp256k1 scratch space, holding memory for the multi-scalar
+/// multiplications used by batch operations. It lives in a caller-provided
+/// block of memory, see `secp256k1_scratch_space_preallocated_create`.
+#[derive(Clone, Debug)]
+#[repr(C)] pub struct ScratchSpace(c_int);
+
 /// Library-internal representation of a Secp256k1 public key
 #[repr(C)]
 #[derive(Copy, Clone)]
@@ -225,6 +238,32 @@ impl core::hash::Hash for PublicKey {
     }
 }
 
+/// Library-internal representation of a Secp256k1 public key together with
+/// a table of its precomputed multiples, see `secp256k1_ec_pubkey_prepare`.
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub struct PreparedPublicKey([c_uchar; 4096]);
+impl_array_newtype!(PreparedPublicKey, c_uchar, 4096);
+
+impl PreparedPublicKey {
+    /// Creates an "uninitialized" FFI prepared public key which is zeroed out
+    ///
+    /// # Safety
+    ///
+    /// If you pass this to any FFI functions, except as an out-pointer,
+    /// the result is likely to be an assertation failure and process
+    /// termination.
+    pub unsafe fn new() -> Self {
+        PreparedPublicKey([0; 4096])
+    }
+}
+
+impl core::fmt::Debug for PreparedPublicKey {
+    fn fmt(&self, f: &mut core::fmt::Formatter) -> core::fmt::Result {
+        f.write_str("PreparedPublicKey(..)")
+    }
+}
+
 /// Library-internal representation of a Secp256k1 signature
 #[repr(C)]
 #[derive(Copy, Clone)]
@@ -315,6 +354,39 @@ impl core::hash::Hash for Signature {
     }
 }
 
+/// Library-internal representation of the nonce dependent part of an ECDSA signature, see
+/// `secp256k1_ecdsa_presignature_create`.
+///
+/// This is secret and must be used for a single signature, so unlike the other types it is
+/// neither `Copy` nor `Clone`.
+#[repr(C)]
+pub struct EcdsaPresignature([c_uchar; 64]);
+
+impl EcdsaPresignature {
+    /// Creates an "uninitialized" FFI presignature which is zeroed out
+    ///
+    /// # Safety
+    ///
+    /// If you pass this to any FFI functions, except as an out-pointer,
+    /// the result is likely to be an assertation failure and process
+    /// termination.
+    pub unsafe fn new() -> Self {
+        EcdsaPresignature([0; 64])
+    }
+
+    /// Attempts to erase the contents of the underlying array, see [`KeyPair::non_secure_erase`].
+    #[inline]
+    pub fn non_secure_erase(&mut self) {
+        non_secure_erase_impl(&mut self.0, [0; 64]);
+    }
+}
+
+impl core::fmt::Debug for EcdsaPresignature {
+    fn fmt(&self, f: &mut core::fmt::Formatter) -> core::fmt::Result {
+        f.write_str("EcdsaPresignature(..)")
+    }
+}
+
 #[repr(C)]
 #[derive(Copy, Clone)]
 #[cfg_attr(fuzzing, derive(PartialEq, Eq, PartialOrd, Ord, Hash))]
@@ -551,6 +623,40 @@ extern "C" {
     #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_context_preallocated_destroy")]
     pub fn secp256k1_context_preallocated_destroy(cx: NonNull<Context>);
 
+    // Scratch spaces
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_scratch_space_preallocated_size")]
+    pub fn secp256k1_scratch_space_preallocated_size(size: size_t) -> size_t;
+
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_scratch_space_preallocated_create")]
+    pub fn secp256k1_scratch_space_preallocated_create(cx: *const Context, prealloc: NonNull<c_void>, size: size_t) -> NonNull<ScratchSpace>;
+
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_scratch_space_preallocated_destroy")]
+    pub fn secp256k1_scratch_space_preallocated_destroy(cx: *const Context, scratch: NonNull<ScratchSpace>);
+
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_scratch_space_checkpoint")]
+    pub fn secp256k1_scratch_space_checkpoint(cx: *const Context, scratch: *const ScratchSpace) -> size_t;
+
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_scratch_space_apply_checkpoint")]
+    pub fn secp256k1_scratch_space_apply_checkpoint(cx: *const Context, scratch: *mut ScratchSpace, checkpoint: size_t);
+
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_schnorrsig_verify_batch_scratch_size")]
+    pub fn secp256k1_schnorrsig_verify_batch_scratch_size(n_sigs: size_t) -> size_t;
+
+    // Tagged hashes
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_tagged_sha256")]
+    pub fn secp256k1_tagged_sha256(cx: *const Context, hash32: *mut c_uchar,
+                                   tag: *const c_uchar, tag_len: size_t,
+                                   msg: *const c_uchar, msg_len: size_t) -> c_int;
+
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_tagged_sha256_midstate")]
+    pub fn secp256k1_tagged_sha256_midstate(cx: *const Context, midstate32: *mut c_uchar,
+                                            tag: *const c_uchar, tag_len: size_t) -> c_int;
+
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_tagged_sha256_from_midstate")]
+    pub fn secp256k1_tagged_sha256_from_midstate(cx: *const Context, hash32: *mut c_uchar,
+                                                 midstate32: *const c_uchar,
+                                                 msg: *const c_uchar, msg_len: size_t) -> c_int;
+
     // Signatures
     #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_ecdsa_signature_parse_der")]
     pub fn secp256k1_ecdsa_signature_parse_der(cx: *const Context, sig: *mut Signature,
@@ -640,6 +746,12 @@ extern "C" {
                                      input: *const c_uchar, in_len: size_t)
                                      -> c_int;
 
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_ec_pubkey_parse_batch")]
+    pub fn secp256k1_ec_pubkey_parse_batch(cx: *const Context, pks: *mut PublicKey,
+                                           inputs: *const *const c_uchar, in_len: size_t,
+                                           n: size_t)
+                                           -> c_int;
+
     #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_ec_pubkey_serialize")]
     pub fn secp256k1_ec_pubkey_serialize(cx: *const Context, output: *mut c_uchar,
                                          out_len: *mut size_t, pk: *const PublicKey,
@@ -651,6 +763,18 @@ extern "C" {
     pub fn secp256k1_ec_pubkey_create(cx: *const Context, pk: *mut PublicKey,
                                       sk: *const c_uchar) -> c_int;
 
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_ec_pubkey_create_batch")]
+    pub fn secp256k1_ec_pubkey_create_batch(cx: *const Context,
+                                            pks: *mut PublicKey,
+                                            sks: *const *const c_uchar,
+                                            n: size_t)
+                                            -> c_int;
+
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_ec_pubkey_prepare")]
+    pub fn secp256k1_ec_pubkey_prepare(cx: *const Context,
+                                       prepared: *mut PreparedPublicKey,
+                                       pk: *const PublicKey)
+                                       -> c_int;
 
     #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_ec_pubkey_negate")]
     pub fn secp256k1_ec_pubkey_negate(cx: *const Context,
@@ -682,6 +806,14 @@ extern "C" {
                                        n: c_int)
                                        -> c_int;
 
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_ec_pubkey_range")]
+    pub fn secp256k1_ec_pubkey_range(cx: *const Context,
+                                     pks: *mut PublicKey,
+                                     next: *mut PublicKey,
+                                     step: *const PublicKey,
+                                     n: size_t)
+                                     -> c_int;
+
     #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_ecdh")]
     pub fn secp256k1_ecdh(
         cx: *const Context,
@@ -692,6 +824,18 @@ extern "C" {
         data: *mut c_void,
     ) -> c_int;
 
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_ecdh_many")]
+    pub fn secp256k1_ecdh_many(
+        cx: *const Context,
+        output: *mut c_uchar,
+        outputlen: size_t,
+        pubkeys: *const PublicKey,
+        n_points: size_t,
+        seckey: *const c_uchar,
+        hashfp: EcdhHashFn,
+        data: *mut c_void,
+    ) -> c_int;
+
     // ECDSA
     #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_ecdsa_verify")]
     pub fn secp256k1_ecdsa_verify(cx: *const Context,
@@ -700,6 +844,22 @@ extern "C" {
                                   pk: *const PublicKey)
                                   -> c_int;
 
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_ecdsa_verify_prepared")]
+    pub fn secp256k1_ecdsa_verify_prepared(cx: *const Context,
+                                           sig: *const Signature,
+                                           msg32: *const c_uchar,
+                                           prepared: *const PreparedPublicKey)
+                                           -> c_int;
+
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_ecdsa_verify_batch")]
+    pub fn secp256k1_ecdsa_verify_batch(cx: *const Context,
+                                        failed_index: *mut size_t,
+                                        sigs: *const *const Signature,
+                                        msg32s: *const *const c_uchar,
+                                        pks: *const *const PublicKey,
+                                        n_sigs: size_t)
+                                        -> c_int;
+
     #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_ecdsa_sign")]
     pub fn secp256k1_ecdsa_sign(cx: *const Context,
                                 sig: *mut Signature,
@@ -709,6 +869,37 @@ extern "C" {
                                 noncedata: *const c_void)
                                 -> c_int;
 
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_ecdsa_sign_grind")]
+    pub fn secp256k1_ecdsa_sign_grind(cx: *const Context,
+                                      sig: *mut Signature,
+                                      msg32: *const c_uchar,
+                                      sk: *const c_uchar,
+                                      check: EcdsaGrindFn,
+                                      data: *mut c_void)
+                                      -> c_int;
+
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_ecdsa_sign_batch")]
+    pub fn secp256k1_ecdsa_sign_batch(cx: *const Context,
+                                      sigs: *mut Signature,
+                                      msgs32: *const *const c_uchar,
+                                      sks: *const *const c_uchar,
+                                      n: size_t)
+                                      -> c_int;
+
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_ecdsa_presignature_create")]
+    pub fn secp256k1_ecdsa_presignature_create(cx: *const Context,
+                                               presig: *mut EcdsaPresignature,
+                                               nonce32: *const c_uchar)
+                                               -> c_int;
+
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_ecdsa_sign_with_presignature")]
+    pub fn secp256k1_ecdsa_sign_with_presignature(cx: *const Context,
+                                                  sig: *mut Signature,
+                                                  msg32: *const c_uchar,
+                                                  sk: *const c_uchar,
+                                                  presig: *mut EcdsaPresignature)
+                                                  -> c_int;
+
     // Schnorr Signatures
     #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_schnorrsig_sign")]
     pub fn secp256k1_schnorrsig_sign(
@@ -730,6 +921,16 @@ extern "C" {
         extra_params: *const SchnorrSigExtraParams,
     ) -> c_int;
 
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_schnorrsig_sign_batch")]
+    pub fn secp256k1_schnorrsig_sign_batch(
+        cx: *const Context,
+        sig64: *mut c_uchar,
+        msgs32: *const *const c_uchar,
+        keypairs: *const *const KeyPair,
+        aux_rand32: *const *const c_uchar,
+        n: size_t,
+    ) -> c_int;
+
     #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_schnorrsig_verify")]
     pub fn secp256k1_schnorrsig_verify(
         cx: *const Context,
@@ -739,6 +940,25 @@ extern "C" {
         pubkey: *const XOnlyPublicKey,
     ) -> c_int;
 
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_schnorrsig_verify_prepared")]
+    pub fn secp256k1_schnorrsig_verify_prepared(
+        cx: *const Context,
+        sig64: *const c_uchar,
+        msg32: *const c_uchar,
+        msglen: size_t,
+        prepared: *const PreparedPublicKey,
+    ) -> c_int;
+
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_schnorrsig_verify_batch")]
+    pub fn secp256k1_schnorrsig_verify_batch(
+        cx: *const Context,
+        scratch: *mut ScratchSpace,
+        sig64: *const *const c_uchar,
+        msg32: *const *const c_uchar,
+        pubkeys: *const *const XOnlyPublicKey,
+        n_sigs: size_t,
+    ) -> c_int;
+
     // Extra keys
     #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_keypair_create")]
     pub fn secp256k1_keypair_create(
@@ -1179,6 +1399,50 @@ mod fuzz_dummy {
         1
     }
 
+    /// Creates each public key with `secp256k1_ec_pubkey_create`
+    pub unsafe fn secp256k1_ec_pubkey_create_batch(cx: *const Context,
+                                                   pks: *mut PublicKey,
+                                                   sks: *const *const c_uchar,
+                                                   n: size_t)
+                                                   -> c_int {
+        let mut ret = 1;
+        for i in 0..n {
+            if secp256k1_ec_pubkey_create(cx, pks.add(i), *sks.add(i)) != 1 {
+                *pks.add(i) = PublicKey::new();
+                ret = 0;
+            }
+        }
+        ret
+    }
+
+    /// Parses each public key with `secp256k1_ec_pubkey_parse`
+    pub unsafe fn secp256k1_ec_pubkey_parse_batch(cx: *const Context,
+                                                  pks: *mut PublicKey,
+                                                  inputs: *const *const c_uchar,
+                                                  in_len: size_t,
+                                                  n: size_t)
+                                                  -> c_int {
+        let mut ret = 1;
+        for i in 0..n {
+            if secp256k1_ec_pubkey_parse(cx, pks.add(i), *inputs.add(i), in_len) != 1 {
+                *pks.add(i) = PublicKey::new();
+                ret = 0;
+            }
+        }
+        ret
+    }
+
+    /// Stores the public key itself instead of a table
+    pub unsafe fn secp256k1_ec_pubkey_prepare(cx: *const Context,
+                                              prepared: *mut PreparedPublicKey,
+                                              pk: *const PublicKey) -> c_int {
+        check_context_flags(cx, 0);
+        assert_eq!(test_pk_validate(cx, pk), 1);
+        *prepared = PreparedPublicKey::new();
+        (*prepared).0[..64].copy_from_slice(&(*pk).0);
+        1
+    }
+
     pub unsafe fn secp256k1_ec_pubkey_negate(cx: *const Context,
                                              pk: *mut PublicKey) -> c_int {
         check_context_flags(cx, 0);
@@ -1234,6 +1498,28 @@ mod fuzz_dummy {
         1
     }
 
+    /// Steps through the range with `secp256k1_ec_pubkey_combine`
+    pub unsafe fn secp256k1_ec_pubkey_range(cx: *const Context,
+                                            pks: *mut PublicKey,
+                                            next: *mut PublicKey,
+                                            step: *const PublicKey,
+                                            n: size_t)
+                                            -> c_int {
+        let mut cur = *next;
+        for i in 0..n {
+            *pks.add(i) = cur;
+            let ins = [&cur as *const PublicKey, step];
+            let mut sum = PublicKey::new();
+            if secp256k1_ec_pubkey_combine(cx, &mut sum, ins.as_ptr(), 2) != 1 {
+                ptr::write_bytes(pks, 0, n);
+                return 0;
+            }
+            cur = sum;
+        }
+        *next = cur;
+        1
+    }
+
     /// Sets out to point^scalar^1s
     pub unsafe fn secp256k1_ecdh(
         cx: *const Context,
@@ -1265,6 +1551,24 @@ mod fuzz_dummy {
         1
     }
 
+    /// Computes each shared secret with `secp256k1_ecdh`
+    pub unsafe fn secp256k1_ecdh_many(
+        cx: *const Context,
+        out: *mut c_uchar,
+        outputlen: size_t,
+        points: *const PublicKey,
+        n_points: size_t,
+        scalar: *const c_uchar,
+        hashfp: EcdhHashFn,
+        data: *mut c_void,
+    ) -> c_int {
+        let mut ret = 1;
+        for i in 0..n_points {
+            ret &= secp256k1_ecdh(cx, out.add(i * outputlen), points.add(i), scalar, hashfp, data);
+        }
+        ret
+    }
+
     // ECDSA
     /// Verifies that sig is msg32||pk[..32]
     pub unsafe fn secp256k1_ecdsa_verify(cx: *const Context,
@@ -1283,6 +1587,36 @@ mod fuzz_dummy {
         }
     }
 
+    /// Verifies the signature with `secp256k1_ecdsa_verify` and the stored public key
+    pub unsafe fn secp256k1_ecdsa_verify_prepared(cx: *const Context,
+                                                  sig: *const Signature,
+                                                  msg32: *const c_uchar,
+                                                  prepared: *const PreparedPublicKey)
+                                                  -> c_int {
+        let mut pk = PublicKey::new();
+        pk.0.copy_from_slice(&(*prepared).0[..64]);
+        secp256k1_ecdsa_verify(cx, sig, msg32, &pk)
+    }
+
+    /// Verifies each signature of the batch with `secp256k1_ecdsa_verify`
+    pub unsafe fn secp256k1_ecdsa_verify_batch(cx: *const Context,
+                                               failed_index: *mut size_t,
+                                               sigs: *const *const Signature,
+                                               msg32s: *const *const c_uchar,
+                                               pks: *const *const PublicKey,
+                                               n_sigs: size_t)
+                                               -> c_int {
+        for i in 0..n_sigs {
+            if secp256k1_ecdsa_verify(cx, *sigs.add(i), *msg32s.add(i), *pks.add(i)) != 1 {
+                if !failed_index.is_null() {
+                    *failed_index = i;
+                }
+                return 0;
+            }
+        }
+        1
+    }
+
     /// Sets sig to msg32||pk[..32]
     pub unsafe fn secp256k1_ecdsa_sign(cx: *const Context,
                                        sig: *mut Signature,
@@ -1305,6 +1639,59 @@ mod fuzz_dummy {
         1
     }
 
+    /// Sets sig to msg32||pk[..32], the first attempt, without calling check
+    pub unsafe fn secp256k1_ecdsa_sign_grind(cx: *const Context,
+                                             sig: *mut Signature,
+                                             msg32: *const c_uchar,
+                                             sk: *const c_uchar,
+                                             _check: EcdsaGrindFn,
+                                             _data: *mut c_void)
+                                             -> c_int {
+        secp256k1_ecdsa_sign(cx, sig, msg32, sk, None, ptr::null())
+    }
+
+    /// Signs each message with `secp256k1_ecdsa_sign`
+    pub unsafe fn secp256k1_ecdsa_sign_batch(cx: *const Context,
+                                             sigs: *mut Signature,
+                                             msgs32: *const *const c_uchar,
+                                             sks: *const *const c_uchar,
+                                             n: size_t)
+                                             -> c_int {
+        let mut ret = 1;
+        for i in 0..n {
+            ret &= secp256k1_ecdsa_sign(cx, sigs.add(i), *msgs32.add(i), *sks.add(i), None, ptr::null());
+        }
+        ret
+    }
+
+    /// Stores the nonce in presig, rejecting zero
+    pub unsafe fn secp256k1_ecdsa_presignature_create(cx: *const Context,
+                                                      presig: *mut EcdsaPresignature,
+                                                      nonce32: *const c_uchar)
+                                                      -> c_int {
+        check_context_flags(cx, SECP256K1_START_SIGN);
+        let nonce_sl = slice::from_raw_parts(nonce32, 32);
+        (*presig).0[..32].copy_from_slice(nonce_sl);
+        (*presig).0[32..].copy_from_slice(nonce_sl);
+        if nonce_sl.iter().all(|&b| b == 0) { 0 } else { 1 }
+    }
+
+    /// Signs with `secp256k1_ecdsa_sign` if presig is not zero, and zeroes presig
+    pub unsafe fn secp256k1_ecdsa_sign_with_presignature(cx: *const Context,
+                                                         sig: *mut Signature,
+                                                         msg32: *const c_uchar,
+                                                         sk: *const c_uchar,
+                                                         presig: *mut EcdsaPresignature)
+                                                         -> c_int {
+        let used = (*presig).0.iter().all(|&b| b == 0);
+        (*presig).0 = [0; 64];
+        if used {
+            *sig = Signature::new();
+            return 0;
+        }
+        secp256k1_ecdsa_sign(cx, sig, msg32, sk, None, ptr::null())
+    }
+
     // Schnorr Signatures
     /// Verifies that sig is msg32||pk[32..]
     pub unsafe fn secp256k1_schnorrsig_verify(
@@ -1328,6 +1715,37 @@ mod fuzz_dummy {
         }
     }
 
+    /// Verifies the signature with `secp256k1_schnorrsig_verify` and the stored public key
+    pub unsafe fn secp256k1_schnorrsig_verify_prepared(
+        cx: *const Context,
+        sig64: *const c_uchar,
+        msg32: *const c_uchar,
+        msglen: size_t,
+        prepared: *const PreparedPublicKey,
+    ) -> c_int {
+        let mut pk = XOnlyPublicKey::new();
+        pk.0.copy_from_slice(&(*prepared).0[..64]);
+        secp256k1_schnorrsig_verify(cx, sig64, msg32, msglen, &pk)
+    }
+
+    /// Verifies each signature of the batch with `secp256k1_schnorrsig_verify`
+    pub unsafe fn secp256k1_schnorrsig_verify_batch(
+        cx: *const Context,
+        _scratch: *mut ScratchSpace,
+        sig64: *const *const c_uchar,
+        msg32: *const *const c_uchar,
+        pubkeys: *const *const XOnlyPublicKey,
+        n_sigs: size_t,
+    ) -> c_int {
+        check_context_flags(cx, SECP256K1_START_VERIFY);
+        for i in 0..n_sigs {
+            if secp256k1_schnorrsig_verify(cx, *sig64.add(i), *msg32.add(i), 32, *pubkeys.add(i)) != 1 {
+                return 0;
+            }
+        }
+        1
+    }
+
     /// Sets sig to msg32||pk[..32]
     pub unsafe fn secp256k1_schnorrsig_sign(
         cx: *const Context,
@@ -1364,6 +1782,22 @@ mod fuzz_dummy {
         secp256k1_schnorrsig_sign(cx, sig, msg, keypair, ptr::null())
     }
 
+    /// Signs each message with `secp256k1_schnorrsig_sign`
+    pub unsafe fn secp256k1_schnorrsig_sign_batch(
+        cx: *const Context,
+        sig64: *mut c_uchar,
+        msgs32: *const *const c_uchar,
+        keypairs: *const *const KeyPair,
+        _aux_rand32: *const *const c_uchar,
+        n: size_t,
+    ) -> c_int {
+        let mut ret = 1;
+        for i in 0..n {
+            ret &= secp256k1_schnorrsig_sign(cx, sig64.add(64 * i), *msgs32.add(i), *keypairs.add(i), ptr::null());
+        }
+        ret
+    }
+
     // Extra keys
     pub unsafe fn secp256k1_keypair_create(
         cx: *const Context,
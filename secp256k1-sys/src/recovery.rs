@@ -15,7 +15,7 @@
 
 //! # FFI of the recovery module
 
-use crate::{Context, Signature, NonceFn, PublicKey, CPtr, impl_array_newtype, secp256k1_context_no_precomp};
+use crate::{Context, ScratchSpace, Signature, NonceFn, PublicKey, CPtr, impl_array_newtype, secp256k1_context_no_precomp};
 use crate::types::*;
 use core::fmt;
 
@@ -127,6 +127,9 @@ extern "C" {
     pub fn secp256k1_ecdsa_recoverable_signature_convert(cx: *const Context, sig: *mut Signature,
                                                          input: *const RecoverableSignature)
                                                          -> c_int;
+
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_ecdsa_recoverable_verify_batch_scratch_size")]
+    pub fn secp256k1_ecdsa_recoverable_verify_batch_scratch_size(n_sigs: size_t) -> size_t;
 }
 
 #[cfg(not(fuzzing))]
@@ -146,6 +149,24 @@ extern "C" {
                                    sig: *const RecoverableSignature,
                                    msg32: *const c_uchar)
                                    -> c_int;
+
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_ecdsa_recover_batch")]
+    pub fn secp256k1_ecdsa_recover_batch(cx: *const Context,
+                                         pks: *mut PublicKey,
+                                         sigs: *const *const RecoverableSignature,
+                                         msg32s: *const *const c_uchar,
+                                         n: size_t)
+                                         -> c_int;
+
+    #[cfg_attr(not(rust_secp_no_symbol_renaming), link_name = "rustsecp256k1_v0_8_1_ecdsa_recoverable_verify_batch")]
+    pub fn secp256k1_ecdsa_recoverable_verify_batch(cx: *const Context,
+                                                    scratch: *mut ScratchSpace,
+                                                    failed_index: *mut size_t,
+                                                    sigs: *const *const RecoverableSignature,
+                                                    msg32s: *const *const c_uchar,
+                                                    pks: *const *const PublicKey,
+                                                    n_sigs: size_t)
+                                                    -> c_int;
 }
 
 
@@ -219,6 +240,46 @@ mod fuzz_dummy {
         }
         1
     }
+
+    /// Recovers each public key with `secp256k1_ecdsa_recover`
+    pub unsafe fn secp256k1_ecdsa_recover_batch(
+        cx: *const Context,
+        pks: *mut PublicKey,
+        sigs: *const *const RecoverableSignature,
+        msg32s: *const *const c_uchar,
+        n: size_t,
+    ) -> c_int {
+        let mut ret = 1;
+        for i in 0..n {
+            if secp256k1_ecdsa_recover(cx, pks.add(i), *sigs.add(i), *msg32s.add(i)) != 1 {
+                *pks.add(i) = PublicKey::new();
+                ret = 0;
+            }
+        }
+        ret
+    }
+
+    /// Verifies each signature of the batch by recovering its public key
+    pub unsafe fn secp256k1_ecdsa_recoverable_verify_batch(
+        cx: *const Context,
+        _scratch: *mut ScratchSpace,
+        failed_index: *mut size_t,
+        sigs: *const *const RecoverableSignature,
+        msg32s: *const *const c_uchar,
+        pks: *const *const PublicKey,
+        n_sigs: size_t,
+    ) -> c_int {
+        for i in 0..n_sigs {
+            let mut pk = PublicKey::new();
+            if secp256k1_ecdsa_recover(cx, &mut pk, *sigs.add(i), *msg32s.add(i)) != 1 || pk != **pks.add(i) {
+                if !failed_index.is_null() {
+                    *failed_index = i;
+                }
+                return 0;
+            }
+        }
+        1
+    }
 }
 
 #[cfg(fuzzing)]
@@ -0,0 +1,17 @@
+//! Runs upstream's C test program, compiled by the build script with the same configuration as the
+//! library when the `c-tests` feature is enabled.
+//!
+//! `SECP256K1_TEST_ITERS` sets the number of iterations (64 by default).
+
+use std::process::{self, Command};
+
+fn main() {
+    let path = env!("SECP256K1_TESTS");
+    let status = Command::new(path).status().unwrap_or_else(|e| {
+        eprintln!("failed to run {}: {}", path, e);
+        process::exit(1);
+    });
+    if !status.success() {
+        process::exit(status.code().unwrap_or(1));
+    }
+}
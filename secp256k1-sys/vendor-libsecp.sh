@@ -99,6 +99,29 @@ patch "$DIR/src/secp256k1.c" "./secp256k1.c.patch"
 patch "$DIR/src/scratch_impl.h" "./scratch_impl.h.patch"
 patch "$DIR/src/util.h" "./util.h.patch"
 
+# Add APIs that are not (yet) provided upstream.
+patch "$DIR/include/secp256k1_preallocated.h" "./secp256k1_preallocated.h.patch"
+patch "$DIR/include/secp256k1_schnorrsig.h" "./secp256k1_schnorrsig.h.patch"
+patch "$DIR/src/modules/schnorrsig/main_impl.h" "./schnorrsig_main_impl.h.patch"
+patch "$DIR/include/secp256k1_recovery.h" "./secp256k1_recovery.h.patch"
+patch "$DIR/src/modules/recovery/main_impl.h" "./recovery_main_impl.h.patch"
+patch "$DIR/src/ecdsa_impl.h" "./ecdsa_impl.h.patch"
+patch "$DIR/src/scalar.h" "./scalar.h.patch"
+patch "$DIR/src/scalar_impl.h" "./scalar_impl.h.patch"
+patch "$DIR/src/ecmult.h" "./ecmult.h.patch"
+patch "$DIR/src/ecmult_impl.h" "./ecmult_impl.h.patch"
+patch "$DIR/src/group.h" "./group.h.patch"
+patch "$DIR/src/group_impl.h" "./group_impl.h.patch"
+patch "$DIR/src/ecmult_const_impl.h" "./ecmult_const_impl.h.patch"
+patch "$DIR/include/secp256k1_ecdh.h" "./secp256k1_ecdh.h.patch"
+patch "$DIR/src/modules/ecdh/main_impl.h" "./ecdh_main_impl.h.patch"
+patch "$DIR/src/hash_impl.h" "./hash_impl.h.patch"
+patch "$DIR/src/hash.h" "./hash.h.patch"
+patch "$DIR/src/bench_internal.c" "./bench_internal.c.patch"
+patch "$DIR/src/field.h" "./field.h.patch"
+patch "$DIR/src/field_impl.h" "./field_impl.h.patch"
+patch "$DIR/src/tests.c" "./tests.c.patch"
+
 # Prefix all methods with rustsecp and a version prefix
 find "$DIR" \
     -not -path '*/\.*' \
@@ -119,6 +142,10 @@ find "./src/" \
     -name "*.rs" \
     -type f \
     -print0 | xargs -0 sed -i -r "s/rustsecp256k1_v[0-9]+_[0-9]+_[0-9]+_(.*)([\"\(])/rustsecp256k1_v${SECP_VENDOR_VERSION_CODE}_\1\2/g"
+# Update the symbols in the C shims of the benchmark programs.
+find "./bench/" \
+    -type f \
+    -print0 | xargs -0 sed -i -r "s/rustsecp256k1_v[0-9]+_[0-9]+_[0-9]+_/rustsecp256k1_v${SECP_VENDOR_VERSION_CODE}_/g"
 
 popd > /dev/null
 
@@ -1,6 +1,7 @@
 use core::marker::PhantomData;
-use core::mem::ManuallyDrop;
+use core::mem::{self, ManuallyDrop};
 use core::ptr::NonNull;
+use core::sync::atomic::{fence, AtomicUsize, Ordering};
 
 #[cfg(feature = "alloc")]
 #[cfg_attr(docsrs, doc(cfg(feature = "alloc")))]
@@ -61,6 +62,107 @@ pub mod global {
     }
 }
 
+#[cfg(feature = "std")]
+#[cfg_attr(docsrs, doc(cfg(feature = "std")))]
+pub use self::thread_context::with_thread_context;
+
+#[cfg(feature = "std")]
+#[cfg_attr(docsrs, doc(cfg(feature = "std")))]
+/// Module implementing a `Secp256k1` context per thread which is rerandomized periodically.
+///
+/// The global context is randomized once, at first use, and can never be rerandomized since that
+/// requires a `&mut` reference. [`with_thread_context`] instead lends out a context owned by the
+/// current thread, which it rerandomizes (if the `rand-std` feature is enabled) after every
+/// [`rerandomize_interval`] uses. Since nothing is shared between threads apart from the interval,
+/// which is only read, using it involves neither locks nor contention.
+pub mod thread_context {
+    use std::cell::{Cell, RefCell};
+    use std::sync::atomic::{AtomicUsize, Ordering};
+
+    use crate::{All, Secp256k1};
+
+    /// The default number of uses after which a thread context is rerandomized.
+    pub const DEFAULT_RERANDOMIZE_INTERVAL: usize = 1024;
+
+    static RERANDOMIZE_INTERVAL: AtomicUsize = AtomicUsize::new(DEFAULT_RERANDOMIZE_INTERVAL);
+
+    struct ThreadContext {
+        secp: RefCell<Secp256k1<All>>,
+        /// Number of uses since the last randomization.
+        uses: Cell<usize>,
+    }
+
+    thread_local! {
+        static CONTEXT: ThreadContext = ThreadContext {
+            secp: RefCell::new(Secp256k1::new()),
+            uses: Cell::new(0),
+        };
+    }
+
+    /// Calls `f` with the context of the current thread.
+    ///
+    /// The context is created (and, if the `rand-std` feature is enabled, randomized using
+    /// `thread_rng`) the first time a thread calls this function, and rerandomized every
+    /// [`rerandomize_interval`] calls. Rerandomization is skipped while the context is lent out by
+    /// an enclosing call.
+    ///
+    /// # Panics
+    ///
+    /// If called while the thread local storage of the current thread is being destroyed.
+    ///
+    /// # Examples
+    ///
+    /// ```
+    /// use secp256k1::{with_thread_context, Message, SecretKey};
+    ///
+    /// let sk = SecretKey::from_slice(&[0xcd; 32]).unwrap();
+    /// let msg = Message::from_slice(&[0xab; 32]).unwrap();
+    /// let sig = with_thread_context(|secp| secp.sign_ecdsa(&msg, &sk));
+    /// ```
+    pub fn with_thread_context<F, R>(f: F) -> R
+    where
+        F: FnOnce(&Secp256k1<All>) -> R,
+    {
+        CONTEXT.with(|ctx| {
+            let uses = ctx.uses.get() + 1;
+            let interval = RERANDOMIZE_INTERVAL.load(Ordering::Relaxed);
+            match ctx.secp.try_borrow_mut() {
+                Ok(mut secp) if interval != 0 && uses >= interval => {
+                    rerandomize(&mut secp);
+                    ctx.uses.set(0);
+                }
+                _ => ctx.uses.set(uses),
+            }
+            let secp = ctx.secp.borrow();
+            f(&secp)
+        })
+    }
+
+    /// Returns the number of uses after which thread contexts are rerandomized, zero meaning never.
+    pub fn rerandomize_interval() -> usize { RERANDOMIZE_INTERVAL.load(Ordering::Relaxed) }
+
+    /// Sets the number of uses after which thread contexts are rerandomized, zero meaning never.
+    ///
+    /// The interval applies to all threads, counting from their last randomization.
+    pub fn set_rerandomize_interval(interval: usize) {
+        RERANDOMIZE_INTERVAL.store(interval, Ordering::Relaxed);
+    }
+
+    #[cfg(all(
+        not(target_arch = "wasm32"),
+        feature = "rand-std",
+        not(feature = "global-context-less-secure")
+    ))]
+    fn rerandomize(secp: &mut Secp256k1<All>) { secp.randomize(&mut rand::thread_rng()); }
+
+    #[cfg(not(all(
+        not(target_arch = "wasm32"),
+        feature = "rand-std",
+        not(feature = "global-context-less-secure")
+    )))]
+    fn rerandomize(_secp: &mut Secp256k1<All>) {}
+}
+
 /// A trait for all kinds of contexts that lets you define the exact flags and a function to
 /// deallocate memory. It isn't possible to implement this for types outside this crate.
 ///
@@ -422,3 +524,167 @@ impl<'buf> Secp256k1<VerifyOnlyPreallocated<'buf>> {
         ManuallyDrop::new(Secp256k1 { ctx: raw_ctx, phantom: PhantomData })
     }
 }
+
+/// Upper bound on the size in bytes of a context, which is a few hundred bytes of blinding state
+/// now that the precomputed tables are static.
+const STATIC_CONTEXT_BYTES: usize = 512;
+const STATIC_CONTEXT_WORDS: usize = STATIC_CONTEXT_BYTES / mem::size_of::<usize>();
+
+/// A context with all capabilities which needs no allocation and can be created in a `const`
+/// context, for example in a `static`.
+///
+/// The (re)randomized state of the context is kept in atomics guarded by a sequence lock, so it can
+/// be rerandomized through a shared reference while other threads use it. Every call to
+/// [`StaticContext::with`] copies the latest state into a context on the stack, which costs a
+/// copy of a few hundred bytes rather than an allocation or the `Once` synchronization of the
+/// global context.
+///
+/// Until it is randomized for the first time, the context is equivalent to an unrandomized
+/// [`Secp256k1::new`] context.
+///
+/// # Examples
+///
+/// ```
+/// use secp256k1::{Message, SecretKey, StaticContext};
+///
+/// static SECP: StaticContext = StaticContext::new();
+///
+/// # let seed = [0x42; 32];
+/// // let seed = <32 bytes of random data>
+/// SECP.seeded_randomize(&seed);
+/// let sk = SecretKey::from_slice(&[0xcd; 32]).unwrap();
+/// let msg = Message::from_slice(&[0xab; 32]).unwrap();
+/// let sig = SECP.with(|secp| secp.sign_ecdsa(&msg, &sk));
+/// ```
+#[cfg(any(not(fuzzing), feature = "alloc"))]
+pub struct StaticContext {
+    /// The sequence number of the state, odd while it is being written and zero until the first
+    /// randomization.
+    seq: AtomicUsize,
+    /// The state, a context stored word by word.
+    words: [AtomicUsize; STATIC_CONTEXT_WORDS],
+}
+
+#[cfg(any(not(fuzzing), feature = "alloc"))]
+impl StaticContext {
+    /// Creates a new, unrandomized context.
+    pub const fn new() -> StaticContext {
+        #[allow(clippy::declare_interior_mutable_const)] // Only used to initialize the array.
+        const ZERO: AtomicUsize = AtomicUsize::new(0);
+        StaticContext { seq: AtomicUsize::new(0), words: [ZERO; STATIC_CONTEXT_WORDS] }
+    }
+
+    /// Calls `f` with a copy of the latest state of this context.
+    ///
+    /// Rerandomizations that happen while `f` runs do not affect the copy.
+    #[cfg(not(fuzzing))]
+    pub fn with<F, R>(&self, f: F) -> R
+    where
+        F: for<'buf> FnOnce(&Secp256k1<AllPreallocated<'buf>>) -> R,
+    {
+        let mut buf = [AlignedType::ZERO; STATIC_CONTEXT_BYTES / mem::size_of::<AlignedType>()];
+        let secp = self.load(&mut buf);
+        f(&secp)
+    }
+
+    /// Calls `f` with a copy of the latest state of this context.
+    ///
+    /// Rerandomizations that happen while `f` runs do not affect the copy.
+    #[cfg(fuzzing)]
+    pub fn with<F, R>(&self, f: F) -> R
+    where
+        F: for<'buf> FnOnce(&Secp256k1<AllPreallocated<'buf>>) -> R,
+    {
+        // Fuzzing contexts are much larger, and are not randomized anyway.
+        let mut buf = crate::alloc::vec![AlignedType::ZERO; Secp256k1::preallocate_size()];
+        let secp = Secp256k1::preallocated_new(&mut buf).expect("buffer has the size of a context");
+        f(&secp)
+    }
+
+    /// (Re)randomizes the context for extra sidechannel resistance, see
+    /// [`Secp256k1::randomize`].
+    #[cfg(feature = "rand")]
+    #[cfg_attr(docsrs, doc(cfg(feature = "rand")))]
+    pub fn randomize<R: rand::Rng + ?Sized>(&self, rng: &mut R) {
+        let mut seed = [0u8; 32];
+        rng.fill_bytes(&mut seed);
+        self.seeded_randomize(&seed);
+    }
+
+    /// (Re)randomizes the context given 32 bytes of cryptographically-secure random data, see
+    /// [`Secp256k1::seeded_randomize`].
+    ///
+    /// If several threads rerandomize the context at once, the state written last wins.
+    #[cfg(not(fuzzing))]
+    pub fn seeded_randomize(&self, seed: &[u8; 32]) {
+        let mut buf = [AlignedType::ZERO; STATIC_CONTEXT_BYTES / mem::size_of::<AlignedType>()];
+        let mut secp = self.load(&mut buf);
+        secp.seeded_randomize(seed);
+        let src = secp.ctx.as_ptr() as *const usize;
+
+        let mut seq = self.seq.load(Ordering::Relaxed);
+        loop {
+            if seq & 1 == 1 {
+                seq = self.seq.load(Ordering::Relaxed);
+                continue;
+            }
+            match self.seq.compare_exchange_weak(seq, seq + 1, Ordering::Acquire, Ordering::Relaxed)
+            {
+                Ok(_) => break,
+                Err(current) => seq = current,
+            }
+        }
+        fence(Ordering::Release);
+        for (i, word) in self.words.iter().enumerate() {
+            word.store(unsafe { src.add(i).read() }, Ordering::Relaxed);
+        }
+        self.seq.store(seq + 2, Ordering::Release);
+    }
+
+    /// (Re)randomizes the context given 32 bytes of cryptographically-secure random data, see
+    /// [`Secp256k1::seeded_randomize`].
+    #[cfg(fuzzing)]
+    pub fn seeded_randomize(&self, _seed: &[u8; 32]) {}
+
+    /// Creates a context in `buf` holding the latest state.
+    #[cfg(not(fuzzing))]
+    fn load<'buf>(
+        &self,
+        buf: &'buf mut [AlignedType; STATIC_CONTEXT_BYTES / mem::size_of::<AlignedType>()],
+    ) -> Secp256k1<AllPreallocated<'buf>> {
+        let dst = buf.as_mut_ptr() as *mut usize;
+        loop {
+            let seq = self.seq.load(Ordering::Acquire);
+            if seq == 0 {
+                return Secp256k1::preallocated_new(buf)
+                    .expect("STATIC_CONTEXT_BYTES is larger than a context");
+            }
+            if seq & 1 == 1 {
+                continue;
+            }
+            for (i, word) in self.words.iter().enumerate() {
+                unsafe { dst.add(i).write(word.load(Ordering::Relaxed)) };
+            }
+            fence(Ordering::Acquire);
+            if self.seq.load(Ordering::Relaxed) == seq {
+                break;
+            }
+        }
+        // The state was copied from a context created by `preallocated_new` in a buffer of the same
+        // size and randomized in `seeded_randomize`, and contexts are plain data.
+        let ctx = unsafe { NonNull::new_unchecked(dst as *mut ffi::Context) };
+        ManuallyDrop::into_inner(unsafe { Secp256k1::from_raw_all(ctx) })
+    }
+}
+
+#[cfg(any(not(fuzzing), feature = "alloc"))]
+impl Default for StaticContext {
+    fn default() -> Self { Self::new() }
+}
+
+#[cfg(any(not(fuzzing), feature = "alloc"))]
+impl core::fmt::Debug for StaticContext {
+    fn fmt(&self, f: &mut core::fmt::Formatter) -> core::fmt::Result {
+        f.debug_struct("StaticContext").field("seq", &self.seq.load(Ordering::Relaxed)).finish()
+    }
+}
@@ -20,6 +20,8 @@ use core::{ptr, str};
 
 use secp256k1_sys::types::{c_int, c_uchar, c_void};
 
+#[cfg(feature = "alloc")]
+use crate::alloc::{vec, vec::Vec};
 use crate::ffi::{self, CPtr};
 use crate::key::{PublicKey, SecretKey};
 use crate::{constants, Error};
@@ -27,6 +29,9 @@ use crate::{constants, Error};
 // The logic for displaying shared secrets relies on this (see `secret.rs`).
 const SHARED_SECRET_SIZE: usize = constants::SECRET_KEY_SIZE;
 
+// Number of shared points computed at once by `shared_secret_points_with`.
+const SHARED_POINTS_CHUNK: usize = 64;
+
 /// Enables two parties to create a shared secret without revealing their own secrets.
 ///
 /// # Examples
@@ -67,6 +72,33 @@ impl SharedSecret {
         SharedSecret(buf)
     }
 
+    /// Creates the shared secrets of `scalar` with each of `points`.
+    ///
+    /// Gives the same results as calling [`SharedSecret::new`] for every point, but the secret
+    /// key is recoded only once and the shared points share their conversion to affine
+    /// coordinates, so this is considerably faster for many points.
+    #[cfg(feature = "alloc")]
+    #[cfg_attr(docsrs, doc(cfg(feature = "alloc")))]
+    pub fn new_many(points: &[PublicKey], scalar: &SecretKey) -> Vec<SharedSecret> {
+        let mut buf = vec![0u8; points.len() * SHARED_SECRET_SIZE];
+        let res = unsafe {
+            ffi::secp256k1_ecdh_many(
+                ffi::secp256k1_context_no_precomp,
+                buf.as_mut_ptr(),
+                SHARED_SECRET_SIZE,
+                points.as_ptr() as *const ffi::PublicKey,
+                points.len(),
+                scalar.as_c_ptr(),
+                ffi::secp256k1_ecdh_hash_function_default,
+                ptr::null_mut(),
+            )
+        };
+        debug_assert_eq!(res, 1);
+        buf.chunks_exact(SHARED_SECRET_SIZE)
+            .map(|bytes| SharedSecret::from_slice(bytes).expect("chunks of the right size"))
+            .collect()
+    }
+
     /// Returns the shared secret as a byte value.
     #[inline]
     pub fn secret_bytes(&self) -> [u8; SHARED_SECRET_SIZE] { self.0 }
@@ -156,6 +188,75 @@ pub fn shared_secret_point(point: &PublicKey, scalar: &SecretKey) -> [u8; 64] {
     xy
 }
 
+/// Creates the shared points of `scalar` with each of `points`.
+///
+/// The many-point version of [`shared_secret_point`], see [`SharedSecret::new_many`]; the same
+/// hashing caveats apply.
+#[cfg(feature = "alloc")]
+#[cfg_attr(docsrs, doc(cfg(feature = "alloc")))]
+pub fn shared_secret_points(points: &[PublicKey], scalar: &SecretKey) -> Vec<[u8; 64]> {
+    let mut xys = vec![[0u8; 64]; points.len()];
+    ecdh_points(points, scalar, xys.as_mut_ptr() as *mut c_uchar);
+    xys
+}
+
+/// Creates the shared points of `scalar` with each of `points`, passing the index and the 64
+/// byte (x,y) co-ordinates of each to `f` in order.
+///
+/// Lets the caller hash the shared points as they are computed without allocating, see
+/// [`shared_secret_points`].
+///
+/// # Examples
+/// ```
+/// # #[cfg(all(feature = "bitcoin-hashes-std", feature = "rand-std"))] {
+/// # use secp256k1::{ecdh, rand, Secp256k1};
+/// # use secp256k1::hashes::{Hash, sha512};
+///
+/// let s = Secp256k1::new();
+/// let (sk, _) = s.generate_keypair(&mut rand::thread_rng());
+/// let (_, pk1) = s.generate_keypair(&mut rand::thread_rng());
+/// let (_, pk2) = s.generate_keypair(&mut rand::thread_rng());
+/// let pks = [pk1, pk2];
+///
+/// let mut secrets = [sha512::Hash::all_zeros(); 2];
+/// ecdh::shared_secret_points_with(&pks, &sk, |i, point| secrets[i] = sha512::Hash::hash(point));
+/// assert_eq!(secrets[1], sha512::Hash::hash(&ecdh::shared_secret_point(&pks[1], &sk)));
+/// # }
+/// ```
+pub fn shared_secret_points_with<F: FnMut(usize, &[u8; 64])>(
+    points: &[PublicKey],
+    scalar: &SecretKey,
+    mut f: F,
+) {
+    let mut xys = [[0u8; 64]; SHARED_POINTS_CHUNK];
+    for (n, chunk) in points.chunks(SHARED_POINTS_CHUNK).enumerate() {
+        ecdh_points(chunk, scalar, xys.as_mut_ptr() as *mut c_uchar);
+        for (i, xy) in xys[..chunk.len()].iter().enumerate() {
+            f(n * SHARED_POINTS_CHUNK + i, xy);
+        }
+    }
+}
+
+/// Writes the shared points of `scalar` with `points` to `xys`, which must have room for
+/// `points.len()` points.
+fn ecdh_points(points: &[PublicKey], scalar: &SecretKey, xys: *mut c_uchar) {
+    let res = unsafe {
+        ffi::secp256k1_ecdh_many(
+            ffi::secp256k1_context_no_precomp,
+            xys,
+            64,
+            points.as_ptr() as *const ffi::PublicKey,
+            points.len(),
+            scalar.as_c_ptr(),
+            Some(c_callback),
+            ptr::null_mut(),
+        )
+    };
+    // Our callback *always* returns 1.
+    // The scalar was verified to be valid (0 > scalar > group_order) via the type system.
+    debug_assert_eq!(res, 1);
+}
+
 unsafe extern "C" fn c_callback(
     output: *mut c_uchar,
     x: *const c_uchar,
@@ -237,6 +338,43 @@ mod tests {
         assert_eq!(y, new_y);
     }
 
+    #[test]
+    #[cfg(feature = "alloc")]
+    fn ecdh_many() {
+        use crate::ecdh::{
+            shared_secret_point, shared_secret_points, shared_secret_points_with,
+            SHARED_POINTS_CHUNK,
+        };
+        use crate::tests::batch_inputs;
+        use crate::{PublicKey, SecretKey};
+
+        let s = Secp256k1::signing_only();
+        let sk = SecretKey::from_slice(&[0xcd; 32]).unwrap();
+        // More than one chunk of `shared_secret_points_with`.
+        let pks: Vec<_> = batch_inputs(2 * SHARED_POINTS_CHUNK + 22)
+            .iter()
+            .map(|(_, sk)| PublicKey::from_secret_key(&s, sk))
+            .collect();
+
+        let secrets = SharedSecret::new_many(&pks, &sk);
+        let xys = shared_secret_points(&pks, &sk);
+        assert_eq!(secrets.len(), pks.len());
+        assert_eq!(xys.len(), pks.len());
+        let mut count = 0;
+        shared_secret_points_with(&pks, &sk, |i, xy| {
+            assert_eq!(i, count);
+            assert_eq!(*xy, xys[i]);
+            count += 1;
+        });
+        assert_eq!(count, pks.len());
+
+        for (i, pk) in pks.iter().enumerate() {
+            assert_eq!(secrets[i], SharedSecret::new(pk, &sk));
+            assert_eq!(xys[i][..], shared_secret_point(pk, &sk)[..]);
+        }
+        assert!(SharedSecret::new_many(&[], &sk).is_empty());
+    }
+
     #[test]
     #[cfg(not(fuzzing))]
     #[cfg(all(feature = "bitcoin-hashes-std", feature = "rand-std"))]
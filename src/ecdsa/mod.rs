@@ -1,21 +1,28 @@
 //! Structs and functionality related to the ECDSA signature algorithm.
 //!
 
+mod presignature;
 #[cfg(feature = "recovery")]
 mod recovery;
 pub mod serialized_signature;
 
 use core::{fmt, ptr, str};
 
+pub use self::presignature::Presignature;
+#[cfg(feature = "rand-std")]
+pub use self::presignature::PresignaturePool;
 #[cfg(feature = "recovery")]
 #[cfg_attr(docsrs, doc(cfg(feature = "recovery")))]
-pub use self::recovery::{RecoverableSignature, RecoveryId};
+pub use self::recovery::{recoverable_batch_scratch_size, RecoverableSignature, RecoveryId};
 pub use self::serialized_signature::SerializedSignature;
+#[cfg(feature = "alloc")]
+use crate::alloc::{vec, vec::Vec};
 use crate::ffi::CPtr;
 #[cfg(feature = "global-context")]
 use crate::SECP256K1;
 use crate::{
-    ffi, from_hex, Error, Message, PublicKey, Secp256k1, SecretKey, Signing, Verification,
+    ffi, from_hex, Error, Message, PreparedPublicKey, PublicKey, Secp256k1, SecretKey, Signing,
+    Verification,
 };
 
 /// An ECDSA signature
@@ -292,43 +299,37 @@ impl<C: Signing> Secp256k1<C> {
         self.sign_ecdsa_with_noncedata_pointer(msg, sk, Some(noncedata))
     }
 
-    fn sign_grind_with_check(
+    fn sign_grind_with_check<F: Fn(&ffi::Signature) -> bool>(
         &self,
         msg: &Message,
         sk: &SecretKey,
-        check: impl Fn(&ffi::Signature) -> bool,
+        check: F,
     ) -> Signature {
-        let mut entropy_p: *const ffi::types::c_void = ptr::null();
-        let mut counter: u32 = 0;
-        let mut extra_entropy = [0u8; 32];
-        loop {
-            unsafe {
-                let mut ret = ffi::Signature::new();
-                // We can assume the return value because it's not possible to construct
-                // an invalid signature from a valid `Message` and `SecretKey`
-                assert_eq!(
-                    ffi::secp256k1_ecdsa_sign(
-                        self.ctx.as_ptr(),
-                        &mut ret,
-                        msg.as_c_ptr(),
-                        sk.as_c_ptr(),
-                        ffi::secp256k1_nonce_function_rfc6979,
-                        entropy_p
-                    ),
-                    1
-                );
-                if check(&ret) {
-                    return Signature::from(ret);
-                }
-
-                counter += 1;
-                extra_entropy[..4].copy_from_slice(&counter.to_le_bytes());
-                entropy_p = extra_entropy.as_c_ptr().cast::<ffi::types::c_void>();
-
-                // When fuzzing, these checks will usually spinloop forever, so just short-circuit them.
-                #[cfg(fuzzing)]
-                return Signature::from(ret);
-            }
+        unsafe extern "C" fn c_check<F: Fn(&ffi::Signature) -> bool>(
+            sig: *const ffi::Signature,
+            data: *mut ffi::types::c_void,
+        ) -> ffi::types::c_int {
+            let check = &*(data as *const F);
+            check(&*sig) as ffi::types::c_int
+        }
+
+        unsafe {
+            let mut ret = ffi::Signature::new();
+            // We can assume the return value because it's not possible to construct
+            // an invalid signature from a valid `Message` and `SecretKey`. When fuzzing,
+            // the check would usually spinloop forever, so the first attempt is returned.
+            assert_eq!(
+                ffi::secp256k1_ecdsa_sign_grind(
+                    self.ctx.as_ptr(),
+                    &mut ret,
+                    msg.as_c_ptr(),
+                    sk.as_c_ptr(),
+                    Some(c_check::<F>),
+                    &check as *const F as *mut ffi::types::c_void,
+                ),
+                1
+            );
+            Signature::from(ret)
         }
     }
 
@@ -357,6 +358,35 @@ impl<C: Signing> Secp256k1<C> {
     pub fn sign_ecdsa_low_r(&self, msg: &Message, sk: &SecretKey) -> Signature {
         self.sign_grind_with_check(msg, sk, compact_sig_has_zero_first_bit)
     }
+
+    /// Signs each message of `batch` with its secret key, with the same result as calling
+    /// [`Secp256k1::sign_ecdsa`] on each of them.
+    ///
+    /// The nonce inversions and the conversions of the nonce points to affine coordinates are
+    /// shared across the batch.
+    #[cfg(feature = "alloc")]
+    #[cfg_attr(docsrs, doc(cfg(feature = "alloc")))]
+    pub fn sign_ecdsa_batch(&self, batch: &[(Message, SecretKey)]) -> Vec<Signature> {
+        let msgs: Vec<_> = batch.iter().map(|(msg, _)| msg.as_c_ptr()).collect();
+        let sks: Vec<_> = batch.iter().map(|(_, sk)| sk.as_c_ptr()).collect();
+
+        unsafe {
+            let mut sigs = vec![ffi::Signature::new(); batch.len()];
+            // We can assume the return value because it's not possible to construct
+            // an invalid signature from a valid `Message` and `SecretKey`
+            assert_eq!(
+                ffi::secp256k1_ecdsa_sign_batch(
+                    self.ctx.as_ptr(),
+                    sigs.as_mut_ptr(),
+                    msgs.as_ptr(),
+                    sks.as_ptr(),
+                    batch.len(),
+                ),
+                1
+            );
+            sigs.into_iter().map(Signature::from).collect()
+        }
+    }
 }
 
 impl<C: Verification> Secp256k1<C> {
@@ -402,6 +432,71 @@ impl<C: Verification> Secp256k1<C> {
             }
         }
     }
+
+    /// Checks that `sig` is a valid ECDSA signature for `msg` using the prepared public key `pk`.
+    ///
+    /// Same as [`Secp256k1::verify_ecdsa`], but faster as the multiples of the public key are
+    /// taken from the table of `pk` instead of being recomputed, see [`PreparedPublicKey`].
+    #[inline]
+    pub fn verify_ecdsa_prepared(
+        &self,
+        msg: &Message,
+        sig: &Signature,
+        pk: &PreparedPublicKey,
+    ) -> Result<(), Error> {
+        unsafe {
+            if ffi::secp256k1_ecdsa_verify_prepared(
+                self.ctx.as_ptr(),
+                sig.as_c_ptr(),
+                msg.as_c_ptr(),
+                pk.as_c_ptr(),
+            ) == 0
+            {
+                Err(Error::IncorrectSignature)
+            } else {
+                Ok(())
+            }
+        }
+    }
+
+    /// Checks that every signature of `batch` is a valid ECDSA signature for its message and
+    /// public key, with the same result as calling [`Secp256k1::verify_ecdsa`] on each of them.
+    ///
+    /// The scalar inversions needed by the individual verifications are shared across the
+    /// batch. Returns [`Error::IncorrectSignatureInBatch`] with the index of the first incorrect
+    /// signature on failure. If the signatures carry a recovery id, the faster
+    /// `verify_ecdsa_recoverable_batch` (requires the `recovery` feature) folds the whole batch
+    /// into a single multi-scalar multiplication.
+    ///
+    /// The context can be shared between threads, so a large batch may be split into chunks that
+    /// are verified on several threads at once.
+    #[cfg(feature = "alloc")]
+    #[cfg_attr(docsrs, doc(cfg(feature = "alloc")))]
+    pub fn verify_ecdsa_batch(
+        &self,
+        batch: &[(Message, Signature, PublicKey)],
+    ) -> Result<(), Error> {
+        let msgs: Vec<_> = batch.iter().map(|(msg, _, _)| msg.as_c_ptr()).collect();
+        let sigs: Vec<_> = batch.iter().map(|(_, sig, _)| sig.as_c_ptr()).collect();
+        let pks: Vec<_> = batch.iter().map(|(_, _, pk)| pk.as_c_ptr()).collect();
+
+        let mut failed_index = 0;
+        unsafe {
+            if ffi::secp256k1_ecdsa_verify_batch(
+                self.ctx.as_ptr(),
+                &mut failed_index,
+                sigs.as_ptr(),
+                msgs.as_ptr(),
+                pks.as_ptr(),
+                batch.len(),
+            ) == 0
+            {
+                Err(Error::IncorrectSignatureInBatch(failed_index))
+            } else {
+                Ok(())
+            }
+        }
+    }
 }
 
 pub(crate) fn compact_sig_has_zero_first_bit(sig: &ffi::Signature) -> bool {
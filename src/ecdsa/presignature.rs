@@ -0,0 +1,353 @@
+//! Support for ECDSA presignatures, the nonce dependent part of a signature computed ahead of
+//! time.
+//!
+//! Most of the cost of creating an ECDSA signature is the multiplication of the generator by the
+//! nonce and the inversion of the nonce, neither of which depends on the message or the secret
+//! key. A [`Presignature`] holds the result of both, so that [`Secp256k1::sign_ecdsa_with_presig`]
+//! only has to do two scalar multiplications and an addition. With the `rand-std` feature a
+//! [`PresignaturePool`] keeps a supply of presignatures computed on background threads.
+//!
+//! Unlike [`Secp256k1::sign_ecdsa`], which derives its nonce from the message and the secret key
+//! (RFC6979), presignatures use random nonces, so signatures created from them are not
+//! deterministic. Signing two messages with the same nonce reveals the secret key, so a
+//! presignature can only be used once: it can be neither copied nor cloned, signing consumes it,
+//! and its memory is erased when it is used or dropped.
+
+use core::fmt;
+
+use crate::ecdsa::Signature;
+use crate::ffi::{self, CPtr};
+use crate::{Error, Message, Secp256k1, SecretKey, Signing};
+
+/// The nonce dependent part of an ECDSA signature, see the [module documentation](self).
+pub struct Presignature(ffi::EcdsaPresignature);
+
+impl Presignature {
+    /// Computes a presignature for `nonce`, which must be uniformly random, secret, and never
+    /// used again.
+    ///
+    /// # Errors
+    ///
+    /// [`Error::InvalidSecretKey`] if the nonce is not a valid secret key (which is
+    /// cryptographically unlikely for a random nonce).
+    pub fn from_nonce<C: Signing>(
+        secp: &Secp256k1<C>,
+        nonce: &[u8; 32],
+    ) -> Result<Presignature, Error> {
+        unsafe {
+            let mut presig = Presignature(ffi::EcdsaPresignature::new());
+            if ffi::secp256k1_ecdsa_presignature_create(
+                secp.ctx.as_ptr(),
+                &mut presig.0,
+                nonce.as_c_ptr(),
+            ) == 1
+            {
+                Ok(presig)
+            } else {
+                Err(Error::InvalidSecretKey)
+            }
+        }
+    }
+
+    /// Computes a presignature for a nonce drawn from `rng`, which must be cryptographically
+    /// secure.
+    #[cfg(feature = "rand")]
+    #[cfg_attr(docsrs, doc(cfg(feature = "rand")))]
+    pub fn new<R: rand::Rng + rand::CryptoRng + ?Sized, C: Signing>(
+        secp: &Secp256k1<C>,
+        rng: &mut R,
+    ) -> Presignature {
+        loop {
+            let mut nonce = crate::random_32_bytes(rng);
+            let presig = Presignature::from_nonce(secp, &nonce);
+            ffi::non_secure_erase_impl(&mut nonce, [0; 32]);
+            if let Ok(presig) = presig {
+                return presig;
+            }
+        }
+    }
+}
+
+impl Drop for Presignature {
+    fn drop(&mut self) { self.0.non_secure_erase(); }
+}
+
+impl fmt::Debug for Presignature {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result { f.write_str("Presignature(..)") }
+}
+
+impl<C: Signing> Secp256k1<C> {
+    /// Constructs a signature for `msg` using the secret key `sk` and the nonce of `presig`,
+    /// consuming it.
+    ///
+    /// The signature is valid and in lower-S form like one from [`Secp256k1::sign_ecdsa`], but
+    /// not deterministic.
+    ///
+    /// # Examples
+    ///
+    /// ```
+    /// # #[cfg(feature = "rand-std")] {
+    /// # use secp256k1::{rand, Message, Secp256k1};
+    /// # use secp256k1::ecdsa::Presignature;
+    /// let secp = Secp256k1::new();
+    /// let (sk, pk) = secp.generate_keypair(&mut rand::thread_rng());
+    /// let presig = Presignature::new(&secp, &mut rand::thread_rng());
+    ///
+    /// // Later, when the message is known.
+    /// let msg = Message::from_slice(&[0xab; 32]).unwrap();
+    /// let sig = secp.sign_ecdsa_with_presig(&msg, &sk, presig);
+    /// assert!(secp.verify_ecdsa(&msg, &sig, &pk).is_ok());
+    /// # }
+    /// ```
+    pub fn sign_ecdsa_with_presig(
+        &self,
+        msg: &Message,
+        sk: &SecretKey,
+        mut presig: Presignature,
+    ) -> Signature {
+        unsafe {
+            let mut ret = ffi::Signature::new();
+            // The secret key and presignature are valid by construction, and the presignature
+            // cannot have been used before since this consumes it.
+            assert_eq!(
+                ffi::secp256k1_ecdsa_sign_with_presignature(
+                    self.ctx.as_ptr(),
+                    &mut ret,
+                    msg.as_c_ptr(),
+                    sk.as_c_ptr(),
+                    &mut presig.0,
+                ),
+                1
+            );
+            Signature::from(ret)
+        }
+    }
+}
+
+#[cfg(feature = "rand-std")]
+pub use self::pool::PresignaturePool;
+
+#[cfg(feature = "rand-std")]
+mod pool {
+    use std::sync::atomic::{AtomicBool, Ordering};
+    use std::sync::{Arc, Condvar, Mutex};
+    use std::thread;
+    use std::vec::Vec;
+
+    use super::Presignature;
+    use crate::Secp256k1;
+
+    struct Shared {
+        queue: Mutex<Vec<Presignature>>,
+        not_full: Condvar,
+        capacity: usize,
+        shutdown: AtomicBool,
+    }
+
+    /// A supply of [`Presignature`]s computed on background threads.
+    ///
+    /// Each worker thread keeps its own randomized signing context and draws nonces from
+    /// [`rand::thread_rng`]. Workers refill the pool whenever it holds fewer than `capacity`
+    /// presignatures and sleep otherwise. Each presignature is handed out by [`take`] at most
+    /// once; those still in the pool are erased when it is dropped, which also stops the workers.
+    ///
+    /// [`take`]: PresignaturePool::take
+    ///
+    /// # Examples
+    ///
+    /// ```
+    /// # use secp256k1::{rand, Message, Secp256k1};
+    /// # use secp256k1::ecdsa::PresignaturePool;
+    /// let secp = Secp256k1::new();
+    /// let (sk, pk) = secp.generate_keypair(&mut rand::thread_rng());
+    /// let pool = PresignaturePool::new(64, 1);
+    ///
+    /// let msg = Message::from_slice(&[0xab; 32]).unwrap();
+    /// // Fall back to regular signing if the workers cannot keep up.
+    /// let sig = match pool.take() {
+    ///     Some(presig) => secp.sign_ecdsa_with_presig(&msg, &sk, presig),
+    ///     None => secp.sign_ecdsa(&msg, &sk),
+    /// };
+    /// assert!(secp.verify_ecdsa(&msg, &sig, &pk).is_ok());
+    /// ```
+    #[cfg_attr(docsrs, doc(cfg(feature = "rand-std")))]
+    pub struct PresignaturePool {
+        shared: Arc<Shared>,
+        workers: Vec<thread::JoinHandle<()>>,
+    }
+
+    impl PresignaturePool {
+        /// Starts `threads` worker threads filling a pool of up to `capacity` presignatures.
+        ///
+        /// # Panics
+        ///
+        /// If `capacity` or `threads` is zero, or if a thread cannot be spawned.
+        pub fn new(capacity: usize, threads: usize) -> PresignaturePool {
+            assert!(capacity > 0, "the pool must hold at least one presignature");
+            assert!(threads > 0, "the pool needs at least one worker thread");
+            let shared = Arc::new(Shared {
+                queue: Mutex::new(Vec::with_capacity(capacity)),
+                not_full: Condvar::new(),
+                capacity,
+                shutdown: AtomicBool::new(false),
+            });
+            let workers = (0..threads)
+                .map(|_| {
+                    let shared = Arc::clone(&shared);
+                    thread::Builder::new()
+                        .name("secp256k1-presig".into())
+                        .spawn(move || fill(&shared))
+                        .expect("failed to spawn a presignature worker")
+                })
+                .collect();
+            PresignaturePool { shared, workers }
+        }
+
+        /// Takes a presignature out of the pool, or returns `None` if it is empty.
+        pub fn take(&self) -> Option<Presignature> {
+            let presig = self.shared.queue.lock().unwrap().pop();
+            if presig.is_some() {
+                self.shared.not_full.notify_one();
+            }
+            presig
+        }
+
+        /// Returns the number of presignatures currently in the pool.
+        pub fn len(&self) -> usize { self.shared.queue.lock().unwrap().len() }
+
+        /// Returns `true` if the pool is currently empty.
+        pub fn is_empty(&self) -> bool { self.len() == 0 }
+
+        /// Returns the number of presignatures the workers keep in the pool.
+        pub fn capacity(&self) -> usize { self.shared.capacity }
+    }
+
+    impl Drop for PresignaturePool {
+        fn drop(&mut self) {
+            self.shared.shutdown.store(true, Ordering::SeqCst);
+            // Taking the lock orders the store before the workers' next check.
+            drop(self.shared.queue.lock());
+            self.shared.not_full.notify_all();
+            for worker in self.workers.drain(..) {
+                let _ = worker.join();
+            }
+            // Erases the remaining presignatures.
+            self.shared.queue.lock().unwrap().clear();
+        }
+    }
+
+    impl core::fmt::Debug for PresignaturePool {
+        fn fmt(&self, f: &mut core::fmt::Formatter) -> core::fmt::Result {
+            f.debug_struct("PresignaturePool")
+                .field("len", &self.len())
+                .field("capacity", &self.shared.capacity)
+                .field("threads", &self.workers.len())
+                .finish()
+        }
+    }
+
+    /// The loop of a worker thread, computing presignatures while the pool has room for them.
+    fn fill(shared: &Shared) {
+        let mut rng = rand::thread_rng();
+        let mut secp = Secp256k1::signing_only();
+        secp.randomize(&mut rng);
+        loop {
+            {
+                let mut queue = shared.queue.lock().unwrap();
+                while queue.len() >= shared.capacity && !shared.shutdown.load(Ordering::SeqCst) {
+                    queue = shared.not_full.wait(queue).unwrap();
+                }
+            }
+            if shared.shutdown.load(Ordering::SeqCst) {
+                return;
+            }
+            let presig = Presignature::new(&secp, &mut rng);
+            let mut queue = shared.queue.lock().unwrap();
+            if queue.len() < shared.capacity {
+                queue.push(presig);
+            }
+        }
+    }
+}
+
+#[cfg(test)]
+#[allow(unused_imports)]
+mod tests {
+    use super::*;
+    use crate::ffi;
+
+    #[test]
+    #[cfg(all(feature = "alloc", not(fuzzing)))]
+    fn from_nonce_rejects_invalid_nonces() {
+        let secp = Secp256k1::signing_only();
+        assert_eq!(Presignature::from_nonce(&secp, &[0; 32]).unwrap_err(), Error::InvalidSecretKey);
+        assert_eq!(
+            Presignature::from_nonce(&secp, &[0xff; 32]).unwrap_err(),
+            Error::InvalidSecretKey
+        );
+    }
+
+    #[test]
+    #[cfg(feature = "alloc")]
+    fn sign_with_presig() {
+        let secp = Secp256k1::new();
+        let sk = SecretKey::from_slice(&[0xcd; 32]).unwrap();
+        let pk = crate::PublicKey::from_secret_key(&secp, &sk);
+        for i in 1..=16u8 {
+            let msg = Message::from_slice(&[i; 32]).unwrap();
+            let presig = Presignature::from_nonce(&secp, &[i; 32]).unwrap();
+            let sig = secp.sign_ecdsa_with_presig(&msg, &sk, presig);
+            assert!(secp.verify_ecdsa(&msg, &sig, &pk).is_ok());
+        }
+    }
+
+    #[test]
+    #[cfg(feature = "alloc")]
+    fn presignature_is_single_use() {
+        let secp = Secp256k1::new();
+        let sk = SecretKey::from_slice(&[0xcd; 32]).unwrap();
+        let msg = Message::from_slice(&[0xab; 32]).unwrap();
+        let mut presig = Presignature::from_nonce(&secp, &[0x42; 32]).unwrap();
+        unsafe {
+            let mut sig = ffi::Signature::new();
+            let sign = |presig: &mut Presignature, sig: &mut ffi::Signature| {
+                ffi::secp256k1_ecdsa_sign_with_presignature(
+                    secp.ctx.as_ptr(),
+                    sig,
+                    msg.as_c_ptr(),
+                    sk.as_c_ptr(),
+                    &mut presig.0,
+                )
+            };
+            assert_eq!(sign(&mut presig, &mut sig), 1);
+            // The first use erased the presignature, so a second one fails.
+            assert_eq!(sign(&mut presig, &mut sig), 0);
+        }
+    }
+
+    #[test]
+    #[cfg(all(feature = "rand-std", not(fuzzing)))]
+    fn pool() {
+        let secp = Secp256k1::new();
+        let (sk, pk) = secp.generate_keypair(&mut rand::thread_rng());
+        let pool = PresignaturePool::new(8, 2);
+        assert_eq!(pool.capacity(), 8);
+
+        let mut sigs = std::vec::Vec::new();
+        while sigs.len() < 32 {
+            let msg = Message::from_slice(&[sigs.len() as u8 + 1; 32]).unwrap();
+            if let Some(presig) = pool.take() {
+                let sig = secp.sign_ecdsa_with_presig(&msg, &sk, presig);
+                assert!(secp.verify_ecdsa(&msg, &sig, &pk).is_ok());
+                sigs.push(sig);
+            } else {
+                std::thread::yield_now();
+            }
+        }
+        // Every presignature has its own nonce.
+        let rs: std::collections::HashSet<_> =
+            sigs.iter().map(|sig| sig.serialize_compact()[..32].to_vec()).collect();
+        assert_eq!(rs.len(), sigs.len());
+        assert!(pool.len() <= pool.capacity());
+    }
+}
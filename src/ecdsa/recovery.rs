@@ -21,8 +21,12 @@ use core::ptr;
 
 use self::super_ffi::CPtr;
 use super::ffi as super_ffi;
+#[cfg(feature = "alloc")]
+use crate::alloc::{vec, vec::Vec};
 use crate::ecdsa::Signature;
 use crate::ffi::recovery as ffi;
+#[cfg(feature = "alloc")]
+use crate::scratch::ScratchSpace;
 use crate::{key, Error, Message, Secp256k1, Signing, Verification};
 
 /// A tag used for recovering the public key from a compact signature.
@@ -198,6 +202,15 @@ impl<C: Signing> Secp256k1<C> {
     }
 }
 
+/// Returns the number of bytes of scratch space with which a batch of `n_sigs` recoverable
+/// signatures is verified in a single multi-scalar multiplication.
+///
+/// Use it to size the [`ScratchSpace`](crate::scratch::ScratchSpace) passed to
+/// [`Secp256k1::verify_ecdsa_recoverable_batch_with_scratch`].
+pub fn recoverable_batch_scratch_size(n_sigs: usize) -> usize {
+    unsafe { ffi::secp256k1_ecdsa_recoverable_verify_batch_scratch_size(n_sigs) }
+}
+
 impl<C: Verification> Secp256k1<C> {
     /// Determines the public key for which `sig` is a valid signature for
     /// `msg`. Requires a verify-capable context.
@@ -220,6 +233,104 @@ impl<C: Verification> Secp256k1<C> {
             Ok(key::PublicKey::from(pk))
         }
     }
+
+    /// Determines the public key for which each signature of `batch` is a valid signature for
+    /// its message, with the same results as calling [`Secp256k1::recover_ecdsa`] on each of them.
+    ///
+    /// The inversions of the r values and the conversions of the recovered keys to affine
+    /// coordinates are shared by up to 64 signatures at a time. Requires a verify-capable context.
+    #[cfg(feature = "alloc")]
+    #[cfg_attr(docsrs, doc(cfg(feature = "alloc")))]
+    pub fn recover_ecdsa_batch(
+        &self,
+        batch: &[(Message, RecoverableSignature)],
+    ) -> Vec<Result<key::PublicKey, Error>> {
+        let msgs: Vec<_> = batch.iter().map(|(msg, _)| msg.as_c_ptr()).collect();
+        let sigs: Vec<_> = batch.iter().map(|(_, sig)| sig.as_c_ptr()).collect();
+        let mut pks = vec![unsafe { super_ffi::PublicKey::new() }; batch.len()];
+
+        let ret = unsafe {
+            ffi::secp256k1_ecdsa_recover_batch(
+                self.ctx.as_ptr(),
+                pks.as_mut_ptr(),
+                sigs.as_ptr(),
+                msgs.as_ptr(),
+                batch.len(),
+            )
+        };
+
+        // The public keys which could not be recovered are zeroed out.
+        pks.into_iter()
+            .map(|pk| {
+                if ret == 1 || pk.underlying_bytes() != [0; 64] {
+                    Ok(key::PublicKey::from(pk))
+                } else {
+                    Err(Error::InvalidSignature)
+                }
+            })
+            .collect()
+    }
+
+    /// Checks that every signature of `batch` is a valid ECDSA signature for its message and
+    /// public key, with the same result as calling [`Secp256k1::verify_ecdsa`] on each of them
+    /// (after [`RecoverableSignature::to_standard`]).
+    ///
+    /// The recovery ids pin down the R points of the signatures, so the verification equations
+    /// are combined with pseudorandom weights into a single multi-scalar multiplication. If that
+    /// check fails the signatures are verified one by one, and
+    /// [`Error::IncorrectSignatureInBatch`] reports the index of the first incorrect one.
+    ///
+    /// Allocates a scratch space for the batch, use
+    /// [`Secp256k1::verify_ecdsa_recoverable_batch_with_scratch`] to reuse one across calls
+    /// instead.
+    #[cfg(feature = "alloc")]
+    #[cfg_attr(docsrs, doc(cfg(feature = "alloc")))]
+    pub fn verify_ecdsa_recoverable_batch(
+        &self,
+        batch: &[(Message, RecoverableSignature, key::PublicKey)],
+    ) -> Result<(), Error> {
+        let mut scratch = ScratchSpace::new(recoverable_batch_scratch_size(batch.len()));
+        self.verify_ecdsa_recoverable_batch_with_scratch(batch, &mut scratch)
+    }
+
+    /// Checks a batch of recoverable ECDSA signatures, using `scratch` for the multi-scalar
+    /// multiplication.
+    ///
+    /// See [`Secp256k1::verify_ecdsa_recoverable_batch`]. A scratch space of
+    /// [`recoverable_batch_scratch_size`] bytes verifies the batch in one go; a smaller one splits
+    /// it into several multiplications, or falls back to verifying the signatures one by one.
+    #[cfg(feature = "alloc")]
+    #[cfg_attr(docsrs, doc(cfg(feature = "alloc")))]
+    pub fn verify_ecdsa_recoverable_batch_with_scratch(
+        &self,
+        batch: &[(Message, RecoverableSignature, key::PublicKey)],
+        scratch: &mut ScratchSpace,
+    ) -> Result<(), Error> {
+        let msgs: Vec<_> = batch.iter().map(|(msg, _, _)| msg.as_c_ptr()).collect();
+        let sigs: Vec<_> = batch.iter().map(|(_, sig, _)| sig.as_c_ptr()).collect();
+        let pks: Vec<_> = batch.iter().map(|(_, _, pk)| pk.as_c_ptr()).collect();
+
+        let mut failed_index = 0;
+        let checkpoint = scratch.checkpoint();
+        let ret = unsafe {
+            ffi::secp256k1_ecdsa_recoverable_verify_batch(
+                self.ctx.as_ptr(),
+                scratch.as_mut_c_ptr(),
+                &mut failed_index,
+                sigs.as_ptr(),
+                msgs.as_ptr(),
+                pks.as_ptr(),
+                batch.len(),
+            )
+        };
+        scratch.apply_checkpoint(checkpoint);
+
+        if ret == 1 {
+            Ok(())
+        } else {
+            Err(Error::IncorrectSignatureInBatch(failed_index))
+        }
+    }
 }
 
 #[cfg(test)]
@@ -230,7 +341,9 @@ mod tests {
 
     use super::{RecoverableSignature, RecoveryId};
     use crate::constants::ONE;
-    use crate::{Error, Message, Secp256k1, SecretKey};
+    #[cfg(feature = "alloc")]
+    use crate::tests::batch_inputs;
+    use crate::{Error, Message, PublicKey, Secp256k1, SecretKey, BATCH_CHUNK_SIZE};
 
     #[test]
     #[cfg(feature = "rand-std")]
@@ -421,6 +534,87 @@ mod tests {
         assert_eq!(&bytes_in[..], &bytes_out[..]);
     }
 
+    #[test]
+    #[cfg(feature = "alloc")]
+    fn verify_recoverable_batch() {
+        let secp = Secp256k1::new();
+
+        assert!(secp.verify_ecdsa_recoverable_batch(&[]).is_ok());
+
+        // Enough signatures to make the multi-scalar multiplication use Pippenger's algorithm.
+        let mut batch: Vec<_> = batch_inputs(64)
+            .into_iter()
+            .map(|(msg, sk)| {
+                let sig = secp.sign_ecdsa_recoverable(&msg, &sk);
+                (msg, sig, PublicKey::from_secret_key(&secp, &sk))
+            })
+            .collect();
+        assert!(secp.verify_ecdsa_recoverable_batch(&batch[..1]).is_ok());
+        assert!(secp.verify_ecdsa_recoverable_batch(&batch).is_ok());
+
+        // A scratch space too small for the whole batch splits the multiplication up.
+        let mut buf = [crate::AlignedType::ZERO; 1024];
+        let mut scratch = crate::scratch::ScratchSpace::preallocated_new(&mut buf).unwrap();
+        assert!(scratch.size() < super::recoverable_batch_scratch_size(batch.len()));
+        for _ in 0..2 {
+            assert!(secp.verify_ecdsa_recoverable_batch_with_scratch(&batch, &mut scratch).is_ok());
+        }
+
+        // A wrong recovery id does not make an otherwise valid signature fail.
+        #[cfg(not(fuzzing))] // fuzz-sigs encode the public key with the recovery id
+        {
+            let (recid, compact) = batch[9].1.serialize_compact();
+            let recid = RecoveryId((recid.to_i32() + 1) % 4);
+            batch[9].1 = RecoverableSignature::from_compact(&compact, recid).unwrap();
+            assert!(secp.verify_ecdsa_recoverable_batch(&batch).is_ok());
+        }
+
+        // Signatures paired with the wrong messages are reported by the lowest index.
+        batch[17].1 = batch[18].1;
+        assert_eq!(
+            secp.verify_ecdsa_recoverable_batch(&batch),
+            Err(Error::IncorrectSignatureInBatch(17))
+        );
+        batch[5].1 = batch[6].1;
+        assert_eq!(
+            secp.verify_ecdsa_recoverable_batch_with_scratch(&batch, &mut scratch),
+            Err(Error::IncorrectSignatureInBatch(5))
+        );
+    }
+
+    #[test]
+    #[cfg(feature = "alloc")]
+    fn recover_batch() {
+        let secp = Secp256k1::new();
+
+        assert!(secp.recover_ecdsa_batch(&[]).is_empty());
+
+        // More than one chunk of shared inversions.
+        let inputs = batch_inputs(2 * BATCH_CHUNK_SIZE + 22);
+        let mut batch: Vec<_> =
+            inputs.iter().map(|(msg, sk)| (*msg, secp.sign_ecdsa_recoverable(msg, sk))).collect();
+        let expected: Vec<_> =
+            inputs.iter().map(|(_, sk)| Ok(PublicKey::from_secret_key(&secp, sk))).collect();
+        assert_eq!(secp.recover_ecdsa_batch(&batch), expected);
+
+        // A signature without a public key is reported at its index only.
+        #[cfg(not(fuzzing))] // fuzz-sigs encode the public key in the signature
+        {
+            // The R point of a recovery id above 1 has an x co-ordinate of at least the curve
+            // order, which r almost never allows.
+            let (recid, compact) = batch[70].1.serialize_compact();
+            let sig = RecoverableSignature::from_compact(&compact, RecoveryId(recid.to_i32() | 2))
+                .unwrap();
+            batch[70].1 = sig;
+
+            let results = secp.recover_ecdsa_batch(&batch);
+            assert_eq!(results[70], secp.recover_ecdsa(&batch[70].0, &sig));
+            assert_eq!(results[70], Err(Error::InvalidSignature));
+            assert_eq!(results[..70], expected[..70]);
+            assert_eq!(results[71..], expected[71..]);
+        }
+    }
+
     #[test]
     fn test_recov_id_conversion_between_i32() {
         assert!(RecoveryId::from_i32(-1).is_err());
@@ -23,17 +23,20 @@ use core::{fmt, ptr, str};
 #[cfg(feature = "serde")]
 use serde::ser::SerializeTuple;
 
-use crate::ffi::types::c_uint;
+use crate::ffi::types::{c_uchar, c_uint};
 use crate::ffi::{self, CPtr};
 #[cfg(all(feature = "global-context", feature = "rand-std"))]
 use crate::schnorr;
 use crate::Error::{self, InvalidPublicKey, InvalidPublicKeySum, InvalidSecretKey};
-use crate::{constants, from_hex, Scalar, Secp256k1, Signing, Verification};
+use crate::{constants, from_hex, Scalar, Secp256k1, Signing, Verification, BATCH_CHUNK_SIZE};
 #[cfg(feature = "global-context")]
 use crate::{ecdsa, Message, SECP256K1};
 #[cfg(feature = "bitcoin_hashes")]
 use crate::{hashes, ThirtyTwoByteHash};
 
+// Number of compressed keys `PublicKey::from_compressed_batch` keeps the pointers to on the stack.
+const PARSE_CHUNK_SIZE: usize = 64;
+
 /// Secret 256-bit key used as `x` in an ECDSA signature.
 ///
 /// # Side channel attacks
@@ -466,6 +469,40 @@ impl PublicKey {
         }
     }
 
+    /// Creates the public keys of a batch of [`SecretKey`]s, storing the public key of `sks[i]`
+    /// in `pks[i]`.
+    ///
+    /// Equivalent to calling [`PublicKey::from_secret_key`] on every secret key, but cheaper
+    /// because the conversions of the public keys to affine coordinates share a field inversion.
+    ///
+    /// # Panics
+    ///
+    /// If `sks` and `pks` have different lengths.
+    pub fn from_secret_keys_batch<C: Signing>(
+        secp: &Secp256k1<C>,
+        sks: &[SecretKey],
+        pks: &mut [PublicKey],
+    ) {
+        assert_eq!(sks.len(), pks.len(), "secret and public key batches differ in length");
+        for (sks, pks) in sks.chunks(BATCH_CHUNK_SIZE).zip(pks.chunks_mut(BATCH_CHUNK_SIZE)) {
+            let mut sk_ptrs = [ptr::null::<c_uchar>(); BATCH_CHUNK_SIZE];
+            for (sk_ptr, sk) in sk_ptrs.iter_mut().zip(sks) {
+                *sk_ptr = sk.as_c_ptr();
+            }
+            unsafe {
+                // `PublicKey` is a transparent wrapper around `ffi::PublicKey`.
+                let res = ffi::secp256k1_ec_pubkey_create_batch(
+                    secp.ctx.as_ptr(),
+                    pks.as_mut_ptr() as *mut ffi::PublicKey,
+                    sk_ptrs.as_ptr(),
+                    sks.len(),
+                );
+                // As in `from_secret_key`, a `SecretKey` is always valid.
+                debug_assert_eq!(res, 1);
+            }
+        }
+    }
+
     /// Creates a new public key from a [`SecretKey`] and the global [`SECP256K1`] context.
     #[inline]
     #[cfg(feature = "global-context")]
@@ -497,6 +534,50 @@ impl PublicKey {
         }
     }
 
+    /// Parses a batch of compressed public keys, storing the key of `data[i]` in `pks[i]`.
+    ///
+    /// Equivalent to calling [`PublicKey::from_slice`] on every key, but with the `avx2` feature
+    /// and a CPU supporting AVX2, the square roots recovering the y coordinates are computed for
+    /// four keys at once.
+    ///
+    /// # Errors
+    ///
+    /// If any key is invalid, in which case `pks` may have been partially updated.
+    ///
+    /// # Panics
+    ///
+    /// If `data` and `pks` have different lengths.
+    pub fn from_compressed_batch(
+        data: &[[u8; constants::PUBLIC_KEY_SIZE]],
+        pks: &mut [PublicKey],
+    ) -> Result<(), Error> {
+        assert_eq!(data.len(), pks.len(), "input and public key batches differ in length");
+        for (data, pks) in data.chunks(PARSE_CHUNK_SIZE).zip(pks.chunks_mut(PARSE_CHUNK_SIZE)) {
+            let mut ptrs = [ptr::null::<c_uchar>(); PARSE_CHUNK_SIZE];
+            for (ptr, data) in ptrs.iter_mut().zip(data) {
+                *ptr = data.as_c_ptr();
+            }
+            unsafe {
+                // Parse into a buffer so that the zeroed keys of a failed batch never reach `pks`.
+                let mut parsed = [ffi::PublicKey::new(); PARSE_CHUNK_SIZE];
+                if ffi::secp256k1_ec_pubkey_parse_batch(
+                    ffi::secp256k1_context_no_precomp,
+                    parsed.as_mut_ptr(),
+                    ptrs.as_ptr(),
+                    constants::PUBLIC_KEY_SIZE,
+                    data.len(),
+                ) != 1
+                {
+                    return Err(InvalidPublicKey);
+                }
+                for (pk, parsed) in pks.iter_mut().zip(&parsed) {
+                    *pk = PublicKey(*parsed);
+                }
+            }
+        }
+        Ok(())
+    }
+
     /// Creates a new compressed public key using data from BIP-340 [`KeyPair`].
     ///
     /// # Examples
@@ -1549,6 +1630,260 @@ impl<'de> serde::Deserialize<'de> for XOnlyPublicKey {
     }
 }
 
+/// A public key together with a table of its precomputed multiples.
+///
+/// Verifying a signature has to compute a few multiples of the public key before it can get to
+/// the actual elliptic curve multiplication. A prepared key computes them once, and with a wider
+/// window than verification can afford to build on the fly, which makes
+/// [`Secp256k1::verify_ecdsa_prepared`] noticeably faster than [`Secp256k1::verify_ecdsa`] for
+/// keys that verify many signatures. A prepared key takes 4 KiB of memory.
+///
+/// # Examples
+///
+/// ```
+/// # #[cfg(feature = "alloc")] {
+/// use secp256k1::{Message, PreparedPublicKey, PublicKey, Secp256k1, SecretKey};
+///
+/// let secp = Secp256k1::new();
+/// let secret_key = SecretKey::from_slice(&[0xcd; 32]).expect("32 bytes, within curve order");
+/// let prepared = PreparedPublicKey::new(&PublicKey::from_secret_key(&secp, &secret_key));
+///
+/// let message = Message::from_slice(&[0xab; 32]).expect("32 bytes");
+/// let sig = secp.sign_ecdsa(&message, &secret_key);
+/// assert!(secp.verify_ecdsa_prepared(&message, &sig, &prepared).is_ok());
+/// # }
+/// ```
+#[derive(Clone)]
+pub struct PreparedPublicKey {
+    pk: PublicKey,
+    prepared: ffi::PreparedPublicKey,
+}
+
+impl PreparedPublicKey {
+    /// Computes the table of precomputed multiples of `pk`.
+    pub fn new(pk: &PublicKey) -> PreparedPublicKey {
+        unsafe {
+            let mut prepared = ffi::PreparedPublicKey::new();
+            let ret = ffi::secp256k1_ec_pubkey_prepare(
+                ffi::secp256k1_context_no_precomp,
+                &mut prepared,
+                pk.as_c_ptr(),
+            );
+            debug_assert_eq!(ret, 1);
+            PreparedPublicKey { pk: *pk, prepared }
+        }
+    }
+
+    /// Returns the public key this table was computed for.
+    #[inline]
+    pub fn public_key(&self) -> PublicKey { self.pk }
+}
+
+impl From<PublicKey> for PreparedPublicKey {
+    #[inline]
+    fn from(pk: PublicKey) -> PreparedPublicKey { PreparedPublicKey::new(&pk) }
+}
+
+impl PartialEq for PreparedPublicKey {
+    #[inline]
+    fn eq(&self, other: &Self) -> bool { self.pk == other.pk }
+}
+
+impl Eq for PreparedPublicKey {}
+
+impl core::hash::Hash for PreparedPublicKey {
+    fn hash<H: core::hash::Hasher>(&self, state: &mut H) { self.pk.hash(state) }
+}
+
+impl fmt::Debug for PreparedPublicKey {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        f.debug_tuple("PreparedPublicKey").field(&self.pk).finish()
+    }
+}
+
+impl CPtr for PreparedPublicKey {
+    type Target = ffi::PreparedPublicKey;
+
+    fn as_c_ptr(&self) -> *const Self::Target { &self.prepared }
+
+    fn as_mut_c_ptr(&mut self) -> *mut Self::Target { &mut self.prepared }
+}
+
+/// An x-only public key together with a table of its precomputed multiples.
+///
+/// The schnorr counterpart of [`PreparedPublicKey`], used by
+/// [`Secp256k1::verify_schnorr_prepared`]. A prepared key takes 4 KiB of memory.
+#[derive(Clone)]
+pub struct PreparedXOnlyPublicKey {
+    pk: XOnlyPublicKey,
+    prepared: ffi::PreparedPublicKey,
+}
+
+impl PreparedXOnlyPublicKey {
+    /// Computes the table of precomputed multiples of `pk`.
+    pub fn new(pk: &XOnlyPublicKey) -> PreparedXOnlyPublicKey {
+        // Schnorr signatures verify against the point with even Y coordinate.
+        let full = PublicKey::from_x_only_public_key(*pk, Parity::Even);
+        PreparedXOnlyPublicKey { pk: *pk, prepared: PreparedPublicKey::new(&full).prepared }
+    }
+
+    /// Returns the x-only public key this table was computed for.
+    #[inline]
+    pub fn public_key(&self) -> XOnlyPublicKey { self.pk }
+}
+
+impl From<XOnlyPublicKey> for PreparedXOnlyPublicKey {
+    #[inline]
+    fn from(pk: XOnlyPublicKey) -> PreparedXOnlyPublicKey { PreparedXOnlyPublicKey::new(&pk) }
+}
+
+impl PartialEq for PreparedXOnlyPublicKey {
+    #[inline]
+    fn eq(&self, other: &Self) -> bool { self.pk == other.pk }
+}
+
+impl Eq for PreparedXOnlyPublicKey {}
+
+impl core::hash::Hash for PreparedXOnlyPublicKey {
+    fn hash<H: core::hash::Hasher>(&self, state: &mut H) { self.pk.hash(state) }
+}
+
+impl fmt::Debug for PreparedXOnlyPublicKey {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        f.debug_tuple("PreparedXOnlyPublicKey").field(&self.pk).finish()
+    }
+}
+
+impl CPtr for PreparedXOnlyPublicKey {
+    type Target = ffi::PreparedPublicKey;
+
+    fn as_c_ptr(&self) -> *const Self::Target { &self.prepared }
+
+    fn as_mut_c_ptr(&mut self) -> *mut Self::Target { &mut self.prepared }
+}
+
+/// An iterator over the public keys `start`, `start + step`, `start + 2*step`, and so on.
+///
+/// Each public key costs one point addition plus a share of a field inversion, much less than
+/// [`PublicKey::from_secret_key`]. Stepping by the generator (see [`PublicKeyRange::new`]) from
+/// the public key of a secret key `k` yields the public keys of `k`, `k + 1`, `k + 2`, … which
+/// is useful when scanning a range of keys. The iterator ends if it reaches the point at
+/// infinity.
+///
+/// The public keys are not computed in constant time, so they should not be secret.
+///
+/// # Examples
+///
+/// ```
+/// # #[cfg(all(feature = "std", not(fuzzing)))] {
+/// use secp256k1::{PublicKey, PublicKeyRange, Secp256k1, SecretKey};
+///
+/// let secp = Secp256k1::new();
+/// let start = PublicKey::from_secret_key(&secp, &SecretKey::from_slice(&[1; 32]).unwrap());
+/// let next = PublicKey::from_secret_key(&secp, &SecretKey::from_slice(&[
+///     1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+///     1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2,
+/// ]).unwrap());
+/// let mut range = PublicKeyRange::new(start);
+/// assert_eq!(range.next(), Some(start));
+/// assert_eq!(range.next(), Some(next));
+/// # }
+/// ```
+#[derive(Clone)]
+pub struct PublicKeyRange {
+    /// The first public key after `buf`, or `None` if the range ends with `buf`.
+    next: Option<PublicKey>,
+    step: PublicKey,
+    buf: [PublicKey; PublicKeyRange::BLOCK_SIZE],
+    pos: usize,
+    len: usize,
+}
+
+impl PublicKeyRange {
+    /// The number of public keys computed at a time, sharing a field inversion.
+    const BLOCK_SIZE: usize = 64;
+
+    /// Creates an iterator over `start`, `start + G`, `start + 2G`, … where `G` is the generator.
+    pub fn new(start: PublicKey) -> PublicKeyRange {
+        let mut generator = [0x04; constants::UNCOMPRESSED_PUBLIC_KEY_SIZE];
+        generator[1..33].copy_from_slice(&constants::GENERATOR_X);
+        generator[33..].copy_from_slice(&constants::GENERATOR_Y);
+        let generator = PublicKey::from_slice(&generator).expect("the generator is a valid point");
+        PublicKeyRange::with_step(start, generator)
+    }
+
+    /// Creates an iterator over `start`, `start + step`, `start + 2*step`, ….
+    pub fn with_step(start: PublicKey, step: PublicKey) -> PublicKeyRange {
+        PublicKeyRange {
+            next: Some(start),
+            step,
+            buf: [start; PublicKeyRange::BLOCK_SIZE],
+            pos: 0,
+            len: 0,
+        }
+    }
+
+    /// Computes the next block of public keys into `buf`.
+    fn refill(&mut self) {
+        let next = match self.next {
+            Some(ref mut next) => next,
+            None => return,
+        };
+        self.pos = 0;
+        unsafe {
+            // `PublicKey` is a transparent wrapper around `ffi::PublicKey`.
+            if ffi::secp256k1_ec_pubkey_range(
+                ffi::secp256k1_context_no_precomp,
+                self.buf.as_mut_ptr() as *mut ffi::PublicKey,
+                next.as_mut_c_ptr(),
+                self.step.as_c_ptr(),
+                PublicKeyRange::BLOCK_SIZE,
+            ) == 1
+            {
+                self.len = PublicKeyRange::BLOCK_SIZE;
+                return;
+            }
+        }
+        // The range reaches the point at infinity within this block, step up to it one key at a
+        // time.
+        let mut cur = self.next;
+        self.len = 0;
+        while let Some(pk) = cur {
+            if self.len == PublicKeyRange::BLOCK_SIZE {
+                break;
+            }
+            self.buf[self.len] = pk;
+            self.len += 1;
+            cur = pk.combine(&self.step).ok();
+        }
+        self.next = cur;
+    }
+}
+
+impl Iterator for PublicKeyRange {
+    type Item = PublicKey;
+
+    fn next(&mut self) -> Option<PublicKey> {
+        if self.pos == self.len {
+            self.refill();
+            if self.pos == self.len {
+                return None;
+            }
+        }
+        self.pos += 1;
+        Some(self.buf[self.pos - 1])
+    }
+}
+
+impl fmt::Debug for PublicKeyRange {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        f.debug_struct("PublicKeyRange")
+            .field("next", &self.buf[self.pos..self.len].first().or(self.next.as_ref()))
+            .field("step", &self.step)
+            .finish()
+    }
+}
+
 #[cfg(test)]
 #[allow(unused_imports)]
 mod test {
@@ -1561,6 +1896,8 @@ mod test {
     use wasm_bindgen_test::wasm_bindgen_test as test;
 
     use super::{KeyPair, Parity, PublicKey, Secp256k1, SecretKey, XOnlyPublicKey, *};
+    #[cfg(feature = "alloc")]
+    use crate::tests::batch_inputs;
     use crate::Error::{InvalidPublicKey, InvalidSecretKey};
     use crate::{constants, from_hex, to_hex, Scalar};
 
@@ -1602,6 +1939,95 @@ mod test {
         assert!(compressed.is_ok());
     }
 
+    #[test]
+    #[cfg(all(feature = "alloc", not(fuzzing)))]
+    fn pubkey_from_compressed_batch() {
+        let s = Secp256k1::new();
+        // More than one chunk of keys, and a remainder of the groups of four parsed at once.
+        let mut data: Vec<_> = batch_inputs(2 * PARSE_CHUNK_SIZE + 22)
+            .iter()
+            .map(|(_, sk)| PublicKey::from_secret_key(&s, sk).serialize())
+            .collect();
+        let mut pks = vec![PublicKey::from_slice(&data[0]).unwrap(); data.len()];
+        assert_eq!(PublicKey::from_compressed_batch(&data, &mut pks), Ok(()));
+        for (data, pk) in data.iter().zip(&pks) {
+            assert_eq!(*pk, PublicKey::from_slice(data).unwrap());
+        }
+
+        // An x coordinate off the curve, one out of range and a wrong prefix.
+        let mut invalid = [0x02; constants::PUBLIC_KEY_SIZE];
+        invalid[32] = 5;
+        assert!(PublicKey::from_slice(&invalid).is_err());
+        for (i, bad) in [invalid, [0xff; 33], [0x04; 33]].iter().enumerate() {
+            let mut data = data.clone();
+            data[PARSE_CHUNK_SIZE + 33 + i] = *bad;
+            assert_eq!(PublicKey::from_compressed_batch(&data, &mut pks), Err(InvalidPublicKey));
+        }
+        data.truncate(3);
+        assert_eq!(PublicKey::from_compressed_batch(&data, &mut pks[..3]), Ok(()));
+        assert_eq!(PublicKey::from_compressed_batch(&[], &mut []), Ok(()));
+    }
+
+    #[test]
+    #[cfg(feature = "alloc")]
+    fn pubkey_from_secret_keys_batch() {
+        let s = Secp256k1::new();
+        // More than one chunk of keys.
+        let sks: Vec<_> =
+            batch_inputs(2 * BATCH_CHUNK_SIZE + 22).into_iter().map(|(_, sk)| sk).collect();
+        let mut pks = vec![PublicKey::from_secret_key(&s, &sks[0]); sks.len()];
+        PublicKey::from_secret_keys_batch(&s, &sks, &mut pks);
+        for (sk, pk) in sks.iter().zip(&pks) {
+            assert_eq!(*pk, PublicKey::from_secret_key(&s, sk));
+        }
+
+        PublicKey::from_secret_keys_batch(&s, &[], &mut []);
+    }
+
+    #[test]
+    #[cfg(all(feature = "alloc", not(fuzzing)))]
+    fn pubkey_range() {
+        let s = Secp256k1::new();
+        let mut sk = SecretKey::from_slice(&[1; 32]).unwrap();
+        let start = PublicKey::from_secret_key(&s, &sk);
+        // More than one block of keys.
+        for pk in PublicKeyRange::new(start).take(2 * PublicKeyRange::BLOCK_SIZE + 22) {
+            assert_eq!(pk, PublicKey::from_secret_key(&s, &sk));
+            sk = sk.add_tweak(&Scalar::ONE).unwrap();
+        }
+
+        let step = PublicKey::from_secret_key(&s, &SecretKey::from_slice(&[2; 32]).unwrap());
+        let mut expected = start;
+        for _ in 0..100 {
+            expected = expected.combine(&step).unwrap();
+        }
+        assert_eq!(PublicKeyRange::with_step(start, step).nth(100), Some(expected));
+    }
+
+    #[test]
+    #[cfg(all(feature = "alloc", not(fuzzing)))]
+    fn pubkey_range_reaches_infinity() {
+        let s = Secp256k1::new();
+        let key = |i: u8| {
+            let mut sk = [0; 32];
+            sk[31] = i;
+            PublicKey::from_secret_key(&s, &SecretKey::from_slice(&sk).unwrap())
+        };
+        // 3G, 2G, G and then the point at infinity.
+        let range = PublicKeyRange::with_step(key(3), key(1).negate(&s));
+        assert_eq!(range.collect::<Vec<_>>(), vec![key(3), key(2), key(1)]);
+    }
+
+    #[test]
+    #[should_panic]
+    #[cfg(feature = "alloc")]
+    fn pubkey_from_secret_keys_batch_length_mismatch() {
+        let s = Secp256k1::new();
+        let sk = SecretKey::from_slice(&[1; 32]).unwrap();
+        let mut pks = [PublicKey::from_secret_key(&s, &sk); 2];
+        PublicKey::from_secret_keys_batch(&s, &[sk], &mut pks);
+    }
+
     #[test]
     #[cfg(feature = "rand-std")]
     fn keypair_slice_round_trip() {
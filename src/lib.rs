@@ -144,6 +144,20 @@
 //! * `bitcoin-hashes-std` - use the `bitcoin_hashes` library with its `std` feature enabled (implies `bitcoin-hashes`).
 //! * `recovery` - enable functions that can compute the public key from signature.
 //! * `lowmemory` - optimize the library for low-memory environments.
+//! * `ecmult-window-8`, `ecmult-window-15`, `ecmult-window-20`, `ecmult-window-22` - select the
+//!   window size of the precomputed table used to verify signatures (15 by default, overriding
+//!   `lowmemory`). The table takes 2^(window - 1) * 64 bytes, i.e. 8 KiB, 1 MiB, 32 MiB and
+//!   128 MiB respectively. Tables for windows 20 and 22 are generated at build time, the latter
+//!   taking several minutes to compile.
+//! * `ecmult-gen-prec-bits-8` - speed up signing and key generation using a 512 KiB precomputed
+//!   table instead of the default 64 KiB one (overriding `lowmemory`).
+//! * `asm` - use hand-written x86_64 assembly for field and scalar multiplication instead of the
+//!   portable C (ignored on other targets and with MSVC). Which is faster depends on the compiler.
+//! * `sha-ni` - compute SHA-256 (challenges, nonces and ECDH hashes) using the SHA extensions on
+//!   x86_64 CPUs that support them, detected at runtime (ignored on other targets and with MSVC).
+//! * `avx2` - compute the SHA-256 hashes of batch verification eight at a time, and decompress
+//!   batches of public keys four at a time, using AVX2 on x86_64 CPUs that support it, detected at
+//!   runtime (ignored on other targets and with MSVC).
 //! * `global-context` - enable use of global secp256k1 context (implies `std`).
 //! * `serde` - implements serialization and deserialization for types in this crate using `serde`.
 //!           **Important**: `serde` encoding is **not** the same as consensus encoding!
@@ -174,8 +188,12 @@ mod key;
 pub mod constants;
 pub mod ecdh;
 pub mod ecdsa;
+#[cfg(feature = "std")]
+#[cfg_attr(docsrs, doc(cfg(feature = "std")))]
+pub mod pubkey_cache;
 pub mod scalar;
 pub mod schnorr;
+pub mod scratch;
 #[cfg(feature = "serde")]
 mod serde_util;
 
@@ -205,6 +223,10 @@ use crate::hashes::Hash;
 pub use crate::key::{PublicKey, SecretKey, *};
 pub use crate::scalar::Scalar;
 
+/// Number of inputs the batch functions of libsecp256k1 process at a time, sharing one field
+/// inversion (`ECDSA_SIGN_BATCH_CHUNK`, `ECDSA_RECOVER_BATCH_CHUNK` and the like).
+pub(crate) const BATCH_CHUNK_SIZE: usize = 64;
+
 /// Trait describing something that promises to be a 32-byte random number; in particular,
 /// it has negligible probability of being zero or overflowing the group order. Such objects
 /// may be converted to `Message`s without any error paths.
@@ -304,6 +326,8 @@ impl fmt::Display for Message {
 pub enum Error {
     /// Signature failed verification.
     IncorrectSignature,
+    /// The signature at the given index of a batch failed verification.
+    IncorrectSignatureInBatch(usize),
     /// Bad sized message ("messages" are actually fixed-sized digests [`constants::MESSAGE_SIZE`]).
     InvalidMessage,
     /// Bad public key.
@@ -332,6 +356,8 @@ impl fmt::Display for Error {
 
         match *self {
             IncorrectSignature => f.write_str("signature failed verification"),
+            IncorrectSignatureInBatch(i) =>
+                write!(f, "signature at index {} of the batch failed verification", i),
             InvalidMessage => f.write_str("message was not 32 bytes (do you need to hash?)"),
             InvalidPublicKey => f.write_str("malformed public key"),
             InvalidSignature => f.write_str("malformed signature"),
@@ -354,6 +380,7 @@ impl std::error::Error for Error {
     fn source(&self) -> Option<&(dyn std::error::Error + 'static)> {
         match self {
             Error::IncorrectSignature => None,
+            Error::IncorrectSignatureInBatch(_) => None,
             Error::InvalidMessage => None,
             Error::InvalidPublicKey => None,
             Error::InvalidSignature => None,
@@ -549,6 +576,19 @@ mod tests {
         }};
     }
 
+    /// Messages `[3 * i; 32]` with secret keys `[i; 32]` for `i` in `1..=n`, the inputs of the
+    /// batch tests throughout the crate.
+    #[cfg(feature = "alloc")]
+    pub(crate) fn batch_inputs(n: usize) -> Vec<(Message, SecretKey)> {
+        assert!(n <= 255, "batch inputs are built from single bytes");
+        (1..=n as u8)
+            .map(|i| {
+                let msg = Message::from_slice(&[i.wrapping_mul(3); 32]).unwrap();
+                (msg, SecretKey::from_slice(&[i; 32]).unwrap())
+            })
+            .collect()
+    }
+
     #[test]
     #[cfg(feature = "rand-std")]
     fn test_manual_create_destroy() {
@@ -653,6 +693,84 @@ mod tests {
         assert!(full.verify_ecdsa(&msg, &sig, &pk).is_ok());
     }
 
+    #[test]
+    #[cfg(all(feature = "std", not(fuzzing)))]
+    fn test_static_context() {
+        static SECP: StaticContext = StaticContext::new();
+
+        let full = Secp256k1::new();
+        let sk = SecretKey::from_slice(&[0xcd; 32]).unwrap();
+        let pk = PublicKey::from_secret_key(&full, &sk);
+        let msg = Message::from_slice(&[2u8; 32]).unwrap();
+        let sig = full.sign_ecdsa(&msg, &sk);
+
+        assert_eq!(SECP.with(|secp| secp.sign_ecdsa(&msg, &sk)), sig);
+        assert!(SECP.with(|secp| secp.verify_ecdsa(&msg, &sig, &pk)).is_ok());
+
+        // Rerandomizing while other threads sign changes neither signatures nor keys.
+        let threads: Vec<_> = (0..4u8)
+            .map(|i| {
+                std::thread::spawn(move || {
+                    let full = Secp256k1::new();
+                    for j in 0..64u8 {
+                        SECP.seeded_randomize(&[i ^ j.wrapping_mul(7) | 1; 32]);
+                        let sk = SecretKey::from_slice(&[j | 1; 32]).unwrap();
+                        let msg = Message::from_slice(&[i; 32]).unwrap();
+                        assert_eq!(
+                            SECP.with(|secp| secp.sign_ecdsa(&msg, &sk)),
+                            full.sign_ecdsa(&msg, &sk)
+                        );
+                        assert_eq!(
+                            SECP.with(|secp| PublicKey::from_secret_key(secp, &sk)),
+                            PublicKey::from_secret_key(&full, &sk)
+                        );
+                    }
+                })
+            })
+            .collect();
+        for thread in threads {
+            thread.join().unwrap();
+        }
+        assert_eq!(SECP.with(|secp| secp.sign_ecdsa(&msg, &sk)), sig);
+    }
+
+    #[test]
+    #[cfg(all(feature = "rand-std", not(feature = "global-context-less-secure"), not(fuzzing)))]
+    fn test_thread_context() {
+        use crate::thread_context::{rerandomize_interval, set_rerandomize_interval};
+
+        fn state() -> Vec<u8> {
+            with_thread_context(|secp| unsafe {
+                let size = ffi::secp256k1_context_preallocated_clone_size(secp.ctx.as_ptr());
+                core::slice::from_raw_parts(secp.ctx.as_ptr() as *const u8, size).to_vec()
+            })
+        }
+
+        let full = Secp256k1::new();
+        let sk = SecretKey::from_slice(&[0xcd; 32]).unwrap();
+        let msg = Message::from_slice(&[2u8; 32]).unwrap();
+
+        set_rerandomize_interval(2);
+        assert_eq!(rerandomize_interval(), 2);
+        let before = state();
+        assert_eq!(
+            with_thread_context(|secp| secp.sign_ecdsa(&msg, &sk)),
+            full.sign_ecdsa(&msg, &sk)
+        );
+        // The context was rerandomized by one of the two uses.
+        assert_ne!(state(), before);
+
+        // It is not rerandomized while lent out.
+        let nested = with_thread_context(|outer| {
+            let before = state();
+            let after = state();
+            assert_eq!(before, after);
+            with_thread_context(|inner| inner.sign_ecdsa(&msg, &sk)) == outer.sign_ecdsa(&msg, &sk)
+        });
+        assert!(nested);
+        set_rerandomize_interval(thread_context::DEFAULT_RERANDOMIZE_INTERVAL);
+    }
+
     #[test]
     #[cfg(feature = "rand-std")]
     fn capabilities() {
@@ -953,6 +1071,64 @@ mod tests {
         assert_eq!(secp.verify_ecdsa(&msg, &sig, &pk), Ok(()));
     }
 
+    #[test]
+    #[cfg(not(fuzzing))] // fixed sig vectors can't work with fuzz-sigs
+    #[cfg(feature = "alloc")]
+    fn test_verify_ecdsa_batch() {
+        let secp = Secp256k1::new();
+        assert!(secp.verify_ecdsa_batch(&[]).is_ok());
+
+        let mut batch: Vec<_> = batch_inputs(39)
+            .into_iter()
+            .map(|(msg, sk)| {
+                (msg, secp.sign_ecdsa(&msg, &sk), PublicKey::from_secret_key(&secp, &sk))
+            })
+            .collect();
+        assert!(secp.verify_ecdsa_batch(&batch).is_ok());
+
+        // The transaction signature from `test_low_s`, which only verifies once normalized.
+        let sig = hex!("3046022100839c1fbc5304de944f697c9f4b1d01d1faeba32d751c0f7acb21ac8a0f436a72022100e89bd46bb3a5a62adc679f659b7ce876d83ee297c7a5587b2011c4fcc72eab45");
+        let pk = hex!("031ee99d2b786ab3b0991325f2de8489246a6a3fdb700f6d0511b1d80cf5f4cd43");
+        let msg = hex!("a4965ca63b7d8562736ceec36dfa5a11bf426eb65be8ea3f7a49ae363032da0d");
+        let mut sig = ecdsa::Signature::from_der(&sig[..]).unwrap();
+        let pk = PublicKey::from_slice(&pk[..]).unwrap();
+        let msg = Message::from_slice(&msg[..]).unwrap();
+
+        batch[35] = (msg, sig, pk);
+        assert_eq!(secp.verify_ecdsa_batch(&batch), Err(Error::IncorrectSignatureInBatch(35)));
+        sig.normalize_s();
+        batch[35].1 = sig;
+        assert!(secp.verify_ecdsa_batch(&batch).is_ok());
+
+        batch[33].0 = batch[34].0;
+        batch[2].2 = batch[3].2;
+        assert_eq!(secp.verify_ecdsa_batch(&batch), Err(Error::IncorrectSignatureInBatch(2)));
+    }
+
+    #[test]
+    #[cfg(feature = "alloc")]
+    fn test_verify_ecdsa_prepared() {
+        let secp = Secp256k1::new();
+        for i in 1..32u8 {
+            let sk = SecretKey::from_slice(&[i; 32]).unwrap();
+            let pk = PublicKey::from_secret_key(&secp, &sk);
+            let prepared = PreparedPublicKey::new(&pk);
+            assert_eq!(prepared.public_key(), pk);
+
+            for j in 0..4u8 {
+                let msg = Message::from_slice(&[i ^ j.wrapping_mul(0x11); 32]).unwrap();
+                let sig = secp.sign_ecdsa(&msg, &sk);
+                assert_eq!(secp.verify_ecdsa_prepared(&msg, &sig, &prepared), Ok(()));
+
+                let other = Message::from_slice(&[!i; 32]).unwrap();
+                assert_eq!(
+                    secp.verify_ecdsa_prepared(&other, &sig, &prepared),
+                    Err(Error::IncorrectSignature)
+                );
+            }
+        }
+    }
+
     #[test]
     #[cfg(not(fuzzing))] // fuzz-sigs have fixed size/format
     #[cfg(any(feature = "alloc", feature = "std"))]
@@ -971,6 +1147,21 @@ mod tests {
         assert_eq!(expected_sig, sig);
     }
 
+    #[test]
+    #[cfg(feature = "alloc")]
+    fn test_sign_ecdsa_batch() {
+        let secp = Secp256k1::new();
+        assert!(secp.sign_ecdsa_batch(&[]).is_empty());
+
+        // More signatures than share one inversion.
+        let batch = batch_inputs(BATCH_CHUNK_SIZE + 6);
+        let sigs = secp.sign_ecdsa_batch(&batch);
+        assert_eq!(sigs.len(), batch.len());
+        for ((msg, sk), sig) in batch.iter().zip(sigs.iter()) {
+            assert_eq!(*sig, secp.sign_ecdsa(msg, sk));
+        }
+    }
+
     #[test]
     #[cfg(not(fuzzing))] // fuzz-sigs have fixed size/format
     #[cfg(any(feature = "alloc", feature = "std"))]
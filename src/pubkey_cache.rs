@@ -0,0 +1,236 @@
+//! Support for caching the decompression of public keys.
+
+use core::fmt;
+use core::hash::{BuildHasher, Hasher};
+use std::collections::hash_map::RandomState;
+use std::sync::{Mutex, MutexGuard, PoisonError};
+
+use crate::{constants, Error, PublicKey};
+
+/// The number of shards of a cache unless its capacity is smaller.
+const DEFAULT_SHARDS: usize = 16;
+
+/// A bounded cache of parsed compressed public keys.
+///
+/// Parsing a compressed public key takes a field square root to recover the y coordinate, which is
+/// by far the most expensive part of [`PublicKey::from_slice`]. When the same keys are parsed over
+/// and over, as in validating transactions paying to the same addresses, [`PubkeyCache::parse`]
+/// turns repeated parses into a hash lookup.
+///
+/// The cache is split into shards, each a table of `capacity / shards` slots behind its own lock,
+/// which is only held to look up or store an entry and never while parsing. A key can only live
+/// in one slot, chosen by a randomly keyed hash of its encoding, and replaces whatever key was
+/// there before, so the cache never grows beyond its capacity. Invalid keys are not cached.
+///
+/// # Examples
+///
+/// ```
+/// use secp256k1::pubkey_cache::PubkeyCache;
+/// use secp256k1::PublicKey;
+///
+/// let cache = PubkeyCache::new(1024);
+/// let bytes = [
+///     0x02, 0x79, 0xbe, 0x66, 0x7e, 0xf9, 0xdc, 0xbb, 0xac, 0x55, 0xa0, 0x62, 0x95, 0xce, 0x87,
+///     0x0b, 0x07, 0x02, 0x9b, 0xfc, 0xdb, 0x2d, 0xce, 0x28, 0xd9, 0x59, 0xf2, 0x81, 0x5b, 0x16,
+///     0xf8, 0x17, 0x98,
+/// ];
+/// let pk = cache.parse(&bytes).unwrap(); // Parsed and cached.
+/// assert_eq!(cache.parse(&bytes).unwrap(), pk); // Looked up.
+/// assert_eq!(pk, PublicKey::from_slice(&bytes).unwrap());
+///
+/// let stats = cache.stats();
+/// assert_eq!((stats.hits, stats.misses), (1, 1));
+/// ```
+pub struct PubkeyCache {
+    shards: Vec<Mutex<Shard>>,
+    slots_per_shard: usize,
+    hasher: RandomState,
+}
+
+struct Shard {
+    slots: Vec<Option<([u8; constants::PUBLIC_KEY_SIZE], PublicKey)>>,
+    hits: u64,
+    misses: u64,
+}
+
+/// Counters of a [`PubkeyCache`], see [`PubkeyCache::stats`].
+#[derive(Copy, Clone, Debug, Default, PartialEq, Eq, Hash)]
+pub struct PubkeyCacheStats {
+    /// The number of compressed keys found in the cache.
+    pub hits: u64,
+    /// The number of compressed keys which had to be parsed, including invalid ones.
+    pub misses: u64,
+}
+
+impl PubkeyCacheStats {
+    /// Returns the fraction of compressed keys found in the cache, or zero if none were parsed.
+    pub fn hit_rate(&self) -> f64 {
+        let total = self.hits + self.misses;
+        if total == 0 {
+            0.0
+        } else {
+            self.hits as f64 / total as f64
+        }
+    }
+}
+
+impl PubkeyCache {
+    /// Creates an empty cache holding up to `capacity` public keys.
+    ///
+    /// # Panics
+    ///
+    /// If `capacity` is zero.
+    pub fn new(capacity: usize) -> PubkeyCache {
+        PubkeyCache::with_shards(capacity, DEFAULT_SHARDS.min(capacity))
+    }
+
+    /// Creates an empty cache holding up to `capacity` public keys in `shards` shards.
+    ///
+    /// More shards mean less contention between threads, but as every key can only live in one
+    /// slot of one shard, a cache is as likely to evict a hot key when full no matter how many
+    /// shards it has. The capacity is rounded up to a multiple of the number of shards.
+    ///
+    /// # Panics
+    ///
+    /// If `capacity` or `shards` is zero.
+    pub fn with_shards(capacity: usize, shards: usize) -> PubkeyCache {
+        assert!(capacity > 0, "the cache must hold at least one public key");
+        assert!(shards > 0, "the cache needs at least one shard");
+        let slots_per_shard = (capacity + shards - 1) / shards;
+        let shards = (0..shards)
+            .map(|_| Mutex::new(Shard { slots: vec![None; slots_per_shard], hits: 0, misses: 0 }))
+            .collect();
+        PubkeyCache { shards, slots_per_shard, hasher: RandomState::new() }
+    }
+
+    /// Parses a public key like [`PublicKey::from_slice`], looking compressed keys up in the cache
+    /// first and caching them after parsing.
+    ///
+    /// Uncompressed keys, which are cheap to parse, bypass the cache.
+    pub fn parse(&self, data: &[u8]) -> Result<PublicKey, Error> {
+        if data.len() != constants::PUBLIC_KEY_SIZE {
+            return PublicKey::from_slice(data);
+        }
+        let mut key = [0u8; constants::PUBLIC_KEY_SIZE];
+        key.copy_from_slice(data);
+
+        let (shard, slot) = self.index(&key);
+        {
+            let mut shard = lock(shard);
+            if let Some((cached, pk)) = shard.slots[slot] {
+                if cached == key {
+                    shard.hits += 1;
+                    return Ok(pk);
+                }
+            }
+            shard.misses += 1;
+        }
+
+        let pk = PublicKey::from_slice(&key)?;
+        lock(shard).slots[slot] = Some((key, pk));
+        Ok(pk)
+    }
+
+    /// Returns the number of public keys the cache can hold.
+    pub fn capacity(&self) -> usize { self.shards.len() * self.slots_per_shard }
+
+    /// Returns the number of public keys currently in the cache.
+    pub fn len(&self) -> usize {
+        self.shards
+            .iter()
+            .map(|shard| lock(shard).slots.iter().filter(|slot| slot.is_some()).count())
+            .sum()
+    }
+
+    /// Returns `true` if the cache holds no public keys.
+    pub fn is_empty(&self) -> bool { self.len() == 0 }
+
+    /// Returns the hit and miss counters summed over all shards.
+    pub fn stats(&self) -> PubkeyCacheStats {
+        self.shards.iter().fold(PubkeyCacheStats::default(), |acc, shard| {
+            let shard = lock(shard);
+            PubkeyCacheStats { hits: acc.hits + shard.hits, misses: acc.misses + shard.misses }
+        })
+    }
+
+    /// Removes all public keys from the cache and resets its counters.
+    pub fn clear(&self) {
+        for shard in &self.shards {
+            let mut shard = lock(shard);
+            shard.slots.iter_mut().for_each(|slot| *slot = None);
+            shard.hits = 0;
+            shard.misses = 0;
+        }
+    }
+
+    /// Returns the shard and the slot in it of a compressed key.
+    fn index(&self, key: &[u8; constants::PUBLIC_KEY_SIZE]) -> (&Mutex<Shard>, usize) {
+        let mut hasher = self.hasher.build_hasher();
+        hasher.write(key);
+        let hash = hasher.finish();
+        let shard = (hash % self.shards.len() as u64) as usize;
+        let slot = ((hash >> 32) % self.slots_per_shard as u64) as usize;
+        (&self.shards[shard], slot)
+    }
+}
+
+/// Locks a shard, ignoring poisoning since a shard is consistent after every statement.
+fn lock(shard: &Mutex<Shard>) -> MutexGuard<'_, Shard> {
+    shard.lock().unwrap_or_else(PoisonError::into_inner)
+}
+
+impl fmt::Debug for PubkeyCache {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        f.debug_struct("PubkeyCache")
+            .field("capacity", &self.capacity())
+            .field("shards", &self.shards.len())
+            .field("stats", &self.stats())
+            .finish()
+    }
+}
+
+#[cfg(test)]
+#[allow(unused_imports)]
+mod tests {
+    use super::*;
+    use crate::{Secp256k1, SecretKey};
+
+    #[test]
+    fn parse() {
+        let secp = Secp256k1::new();
+        let cache = PubkeyCache::with_shards(8, 2);
+        assert_eq!(cache.capacity(), 8);
+        assert!(cache.is_empty());
+
+        let pks: Vec<_> = (1..=32u8)
+            .map(|i| PublicKey::from_secret_key(&secp, &SecretKey::from_slice(&[i; 32]).unwrap()))
+            .collect();
+        for _ in 0..4 {
+            for pk in &pks {
+                assert_eq!(cache.parse(&pk.serialize()), Ok(*pk));
+                assert_eq!(cache.parse(&pk.serialize_uncompressed()), Ok(*pk));
+            }
+        }
+        assert!(cache.len() <= cache.capacity());
+        let stats = cache.stats();
+        assert_eq!(stats.hits + stats.misses, 4 * 32);
+
+        // A hot key stays cached.
+        let stats = cache.stats();
+        for _ in 0..16 {
+            assert_eq!(cache.parse(&pks[0].serialize()), Ok(pks[0]));
+        }
+        assert!(cache.stats().hits >= stats.hits + 15);
+
+        // Invalid keys are rejected and not cached.
+        let mut invalid = pks[0].serialize();
+        invalid[0] = 0x05;
+        assert_eq!(cache.parse(&invalid), Err(Error::InvalidPublicKey));
+        assert_eq!(cache.parse(&[0x02; 32]), Err(Error::InvalidPublicKey));
+
+        cache.clear();
+        assert!(cache.is_empty());
+        assert_eq!(cache.stats(), PubkeyCacheStats::default());
+        assert_eq!(cache.stats().hit_rate(), 0.0);
+    }
+}
@@ -6,8 +6,12 @@ use core::{fmt, ptr, str};
 #[cfg(feature = "rand")]
 use rand::{CryptoRng, Rng};
 
+#[cfg(feature = "alloc")]
+use crate::alloc::{vec, vec::Vec};
 use crate::ffi::{self, CPtr};
-use crate::key::{KeyPair, XOnlyPublicKey};
+use crate::key::{KeyPair, PreparedXOnlyPublicKey, XOnlyPublicKey};
+#[cfg(feature = "alloc")]
+use crate::scratch::ScratchSpace;
 #[cfg(feature = "global-context")]
 use crate::SECP256K1;
 use crate::{
@@ -95,6 +99,74 @@ impl Signature {
     }
 }
 
+/// A BIP340 tagged hash `SHA256(SHA256(tag) || SHA256(tag) || msg)` with the hash of the tag
+/// computed once.
+///
+/// Hashing the tag costs two SHA256 compressions, as much as hashing a 64 byte message. Since it
+/// depends only on the tag, [`TaggedHash::new`] hashes it once and every [`TaggedHash::hash`]
+/// resumes from the resulting midstate. A tag known in advance can be kept in a `static` by
+/// hardcoding its midstate with [`TaggedHash::from_midstate`].
+///
+/// # Examples
+///
+/// ```
+/// use secp256k1::schnorr::TaggedHash;
+///
+/// let tag = TaggedHash::new(b"TapLeaf");
+/// static TAP_LEAF: TaggedHash = TaggedHash::from_midstate([
+///     0x9c, 0xe0, 0xe4, 0xe6, 0x7c, 0x11, 0x6c, 0x39,
+///     0x38, 0xb3, 0xca, 0xf2, 0xc3, 0x0f, 0x50, 0x89,
+///     0xd3, 0xf3, 0x93, 0x6c, 0x47, 0x63, 0x6e, 0x60,
+///     0x7d, 0xb3, 0x3e, 0xea, 0xdd, 0xc6, 0xf0, 0xc9,
+/// ]);
+/// assert_eq!(tag, TAP_LEAF);
+/// assert_eq!(tag.hash(b"leaf"), TAP_LEAF.hash(b"leaf"));
+/// ```
+#[derive(Copy, Clone, PartialEq, Eq, PartialOrd, Ord, Hash, Debug)]
+pub struct TaggedHash([u8; 32]);
+
+impl TaggedHash {
+    /// Hashes `tag` into the midstate of its tagged hashes.
+    pub fn new(tag: &[u8]) -> TaggedHash {
+        let mut midstate = [0u8; 32];
+        unsafe {
+            let ret = ffi::secp256k1_tagged_sha256_midstate(
+                ffi::secp256k1_context_no_precomp,
+                midstate.as_mut_c_ptr(),
+                tag.as_ptr(),
+                tag.len(),
+            );
+            debug_assert_eq!(ret, 1);
+        }
+        TaggedHash(midstate)
+    }
+
+    /// Creates a tagged hash from a midstate returned by [`TaggedHash::midstate`].
+    pub const fn from_midstate(midstate: [u8; 32]) -> TaggedHash { TaggedHash(midstate) }
+
+    /// Returns the SHA256 state words after hashing the tag twice, in big endian order.
+    pub fn midstate(&self) -> [u8; 32] { self.0 }
+
+    /// Computes the tagged hash of `msg`.
+    pub fn hash(&self, msg: &[u8]) -> [u8; 32] {
+        let mut hash = [0u8; 32];
+        unsafe {
+            let ret = ffi::secp256k1_tagged_sha256_from_midstate(
+                ffi::secp256k1_context_no_precomp,
+                hash.as_mut_c_ptr(),
+                self.0.as_c_ptr(),
+                msg.as_ptr(),
+                msg.len(),
+            );
+            debug_assert_eq!(ret, 1);
+        }
+        hash
+    }
+
+    /// Computes the tagged hash of `msg` as a [`Message`] to be signed.
+    pub fn message(&self, msg: &[u8]) -> Message { Message(self.hash(msg)) }
+}
+
 impl<C: Signing> Secp256k1<C> {
     fn sign_schnorr_helper(
         &self,
@@ -156,6 +228,99 @@ impl<C: Signing> Secp256k1<C> {
         rng.fill_bytes(&mut aux);
         self.sign_schnorr_helper(msg, keypair, aux.as_c_ptr() as *const ffi::types::c_uchar)
     }
+
+    #[cfg(feature = "alloc")]
+    fn sign_schnorr_batch_helper(
+        &self,
+        batch: &[(Message, KeyPair)],
+        aux_rand: Option<&[[u8; 32]]>,
+    ) -> Vec<Signature> {
+        let msgs: Vec<_> = batch.iter().map(|(msg, _)| msg.as_c_ptr()).collect();
+        let keypairs: Vec<_> = batch.iter().map(|(_, keypair)| keypair.as_c_ptr()).collect();
+        let aux: Option<Vec<_>> =
+            aux_rand.map(|aux_rand| aux_rand.iter().map(|aux| aux.as_c_ptr()).collect());
+        let mut sigs = vec![0u8; constants::SCHNORR_SIGNATURE_SIZE * batch.len()];
+
+        unsafe {
+            assert_eq!(
+                1,
+                ffi::secp256k1_schnorrsig_sign_batch(
+                    self.ctx.as_ptr(),
+                    sigs.as_mut_ptr(),
+                    msgs.as_ptr(),
+                    keypairs.as_ptr(),
+                    aux.as_ref().map_or(ptr::null(), |aux| aux.as_ptr()),
+                    batch.len(),
+                )
+            );
+        }
+        sigs.chunks_exact(constants::SCHNORR_SIGNATURE_SIZE)
+            .map(|sig| Signature::from_slice(sig).expect("64 bytes"))
+            .collect()
+    }
+
+    /// Creates a schnorr signature of each message of `batch` with its keypair, internally
+    /// using the [`rand::rngs::ThreadRng`] random number generator to generate the auxiliary
+    /// random data.
+    ///
+    /// See [`Secp256k1::sign_schnorr_batch_with_aux_rand`].
+    #[cfg(feature = "rand-std")]
+    #[cfg_attr(docsrs, doc(cfg(feature = "rand-std")))]
+    pub fn sign_schnorr_batch(&self, batch: &[(Message, KeyPair)]) -> Vec<Signature> {
+        let mut rng = rand::thread_rng();
+        let aux_rand: Vec<_> = batch.iter().map(|_| crate::random_32_bytes(&mut rng)).collect();
+        self.sign_schnorr_batch_helper(batch, Some(&aux_rand))
+    }
+
+    /// Creates a schnorr signature of each message of `batch` with its keypair without using
+    /// any auxiliary random data, see [`Secp256k1::sign_schnorr_batch_with_aux_rand`].
+    #[cfg(feature = "alloc")]
+    #[cfg_attr(docsrs, doc(cfg(feature = "alloc")))]
+    pub fn sign_schnorr_batch_no_aux_rand(&self, batch: &[(Message, KeyPair)]) -> Vec<Signature> {
+        self.sign_schnorr_batch_helper(batch, None)
+    }
+
+    /// Creates a schnorr signature of each message of `batch` with its keypair, using
+    /// `aux_rand[i]` as the auxiliary random data of the `i`-th signature.
+    ///
+    /// The result is the same as calling [`Secp256k1::sign_schnorr_with_aux_rand`] on each
+    /// message, but the nonces and challenges are hashed eight at a time and the conversions of
+    /// the nonce points to affine coordinates share a field inversion.
+    ///
+    /// # Panics
+    ///
+    /// If `batch` and `aux_rand` differ in length.
+    #[cfg(feature = "alloc")]
+    #[cfg_attr(docsrs, doc(cfg(feature = "alloc")))]
+    pub fn sign_schnorr_batch_with_aux_rand(
+        &self,
+        batch: &[(Message, KeyPair)],
+        aux_rand: &[[u8; 32]],
+    ) -> Vec<Signature> {
+        assert_eq!(batch.len(), aux_rand.len(), "one auxiliary random value per signature");
+        self.sign_schnorr_batch_helper(batch, Some(aux_rand))
+    }
+
+    /// Creates a schnorr signature of the tagged hash of `msg` using the given auxiliary random
+    /// data, see [`TaggedHash`].
+    pub fn sign_schnorr_tagged_with_aux_rand(
+        &self,
+        tag: &TaggedHash,
+        msg: &[u8],
+        keypair: &KeyPair,
+        aux_rand: &[u8; 32],
+    ) -> Signature {
+        self.sign_schnorr_with_aux_rand(&tag.message(msg), keypair, aux_rand)
+    }
+}
+
+/// Returns the number of bytes of scratch space with which a batch of `n_sigs` signatures is
+/// verified in a single multi-scalar multiplication.
+///
+/// Use it to size the [`ScratchSpace`](crate::scratch::ScratchSpace) passed to
+/// [`Secp256k1::verify_schnorr_batch_with_scratch`].
+pub fn batch_scratch_size(n_sigs: usize) -> usize {
+    unsafe { ffi::secp256k1_schnorrsig_verify_batch_scratch_size(n_sigs) }
 }
 
 impl<C: Verification> Secp256k1<C> {
@@ -182,6 +347,102 @@ impl<C: Verification> Secp256k1<C> {
             }
         }
     }
+
+    /// Verifies a schnorr signature of the tagged hash of `msg`, see [`TaggedHash`].
+    pub fn verify_schnorr_tagged(
+        &self,
+        sig: &Signature,
+        tag: &TaggedHash,
+        msg: &[u8],
+        pubkey: &XOnlyPublicKey,
+    ) -> Result<(), Error> {
+        self.verify_schnorr(sig, &tag.message(msg), pubkey)
+    }
+
+    /// Verifies a schnorr signature using the prepared public key `pubkey`.
+    ///
+    /// Same as [`Secp256k1::verify_schnorr`], but faster as the multiples of the public key are
+    /// taken from the table of `pubkey` instead of being recomputed, see
+    /// [`PreparedXOnlyPublicKey`].
+    pub fn verify_schnorr_prepared(
+        &self,
+        sig: &Signature,
+        msg: &Message,
+        pubkey: &PreparedXOnlyPublicKey,
+    ) -> Result<(), Error> {
+        unsafe {
+            let ret = ffi::secp256k1_schnorrsig_verify_prepared(
+                self.ctx.as_ptr(),
+                sig.as_c_ptr(),
+                msg.as_c_ptr(),
+                32,
+                pubkey.as_c_ptr(),
+            );
+
+            if ret == 1 {
+                Ok(())
+            } else {
+                Err(Error::InvalidSignature)
+            }
+        }
+    }
+
+    /// Verifies a batch of schnorr signatures at once.
+    ///
+    /// The verification equations are combined with pseudorandom weights into a single
+    /// multi-scalar multiplication, which is considerably faster than calling
+    /// [`Secp256k1::verify_schnorr`] for each signature. Returns `Ok(())` only if every
+    /// signature is valid; on failure it does not tell which signature is invalid.
+    ///
+    /// Allocates a scratch space for the batch, use
+    /// [`Secp256k1::verify_schnorr_batch_with_scratch`] to reuse one across calls instead. The
+    /// context can be shared between threads, so a large batch may be split into chunks that are
+    /// verified on several threads at once.
+    #[cfg(feature = "alloc")]
+    #[cfg_attr(docsrs, doc(cfg(feature = "alloc")))]
+    pub fn verify_schnorr_batch(
+        &self,
+        batch: &[(Message, Signature, XOnlyPublicKey)],
+    ) -> Result<(), Error> {
+        let mut scratch = ScratchSpace::new(batch_scratch_size(batch.len()));
+        self.verify_schnorr_batch_with_scratch(batch, &mut scratch)
+    }
+
+    /// Verifies a batch of schnorr signatures at once, using `scratch` for the multi-scalar
+    /// multiplication.
+    ///
+    /// See [`Secp256k1::verify_schnorr_batch`]. A scratch space of [`batch_scratch_size`] bytes
+    /// verifies the batch in one go; a smaller one splits it into several multiplications.
+    #[cfg(feature = "alloc")]
+    #[cfg_attr(docsrs, doc(cfg(feature = "alloc")))]
+    pub fn verify_schnorr_batch_with_scratch(
+        &self,
+        batch: &[(Message, Signature, XOnlyPublicKey)],
+        scratch: &mut ScratchSpace,
+    ) -> Result<(), Error> {
+        let sigs: Vec<_> = batch.iter().map(|(_, sig, _)| sig.as_c_ptr()).collect();
+        let msgs: Vec<_> = batch.iter().map(|(msg, _, _)| msg.as_c_ptr()).collect();
+        let pks: Vec<_> = batch.iter().map(|(_, _, pk)| pk.as_c_ptr()).collect();
+
+        let checkpoint = scratch.checkpoint();
+        let ret = unsafe {
+            ffi::secp256k1_schnorrsig_verify_batch(
+                self.ctx.as_ptr(),
+                scratch.as_mut_c_ptr(),
+                sigs.as_ptr(),
+                msgs.as_ptr(),
+                pks.as_ptr(),
+                batch.len(),
+            )
+        };
+        scratch.apply_checkpoint(checkpoint);
+
+        if ret == 1 {
+            Ok(())
+        } else {
+            Err(Error::InvalidSignature)
+        }
+    }
 }
 
 #[cfg(test)]
@@ -196,8 +457,10 @@ mod tests {
 
     use super::*;
     use crate::schnorr::{KeyPair, Signature, XOnlyPublicKey};
+    #[cfg(feature = "alloc")]
+    use crate::tests::batch_inputs;
     use crate::Error::InvalidPublicKey;
-    use crate::{constants, from_hex, Message, Secp256k1, SecretKey};
+    use crate::{constants, from_hex, Message, Secp256k1, SecretKey, BATCH_CHUNK_SIZE};
 
     #[cfg(all(not(fuzzing), feature = "alloc"))]
     macro_rules! hex_32 {
@@ -292,6 +555,135 @@ mod tests {
         assert!(secp.verify_schnorr(&sig, &msg, &pubkey).is_ok());
     }
 
+    #[test]
+    #[cfg(feature = "alloc")]
+    fn schnorr_sign_batch() {
+        let secp = Secp256k1::new();
+        assert!(secp.sign_schnorr_batch_no_aux_rand(&[]).is_empty());
+
+        // More signatures than share one inversion, the last group of hashes partially filled.
+        let batch: Vec<_> = batch_inputs(BATCH_CHUNK_SIZE + 6)
+            .into_iter()
+            .map(|(msg, sk)| (msg, KeyPair::from_secret_key(&secp, &sk)))
+            .collect();
+        let aux_rand: Vec<_> = (1..=batch.len() as u8).map(|i| [i.wrapping_mul(7); 32]).collect();
+
+        let sigs = secp.sign_schnorr_batch_no_aux_rand(&batch);
+        let aux_sigs = secp.sign_schnorr_batch_with_aux_rand(&batch, &aux_rand);
+        for (i, (msg, keypair)) in batch.iter().enumerate() {
+            assert_eq!(sigs[i], secp.sign_schnorr_no_aux_rand(msg, keypair));
+            assert_eq!(aux_sigs[i], secp.sign_schnorr_with_aux_rand(msg, keypair, &aux_rand[i]));
+        }
+    }
+
+    #[test]
+    #[cfg(feature = "alloc")]
+    fn tagged_hash() {
+        let secp = Secp256k1::new();
+
+        for tag in [&b""[..], b"TapLeaf", &[7u8; 100]].iter() {
+            let tagged = TaggedHash::new(tag);
+            assert_eq!(TaggedHash::from_midstate(tagged.midstate()), tagged);
+            for len in [0, 1, 31, 32, 55, 56, 64, 200].iter() {
+                let msg = &[*len as u8; 200][..*len];
+                let mut expected = [0u8; 32];
+                unsafe {
+                    assert_eq!(
+                        ffi::secp256k1_tagged_sha256(
+                            ffi::secp256k1_context_no_precomp,
+                            expected.as_mut_c_ptr(),
+                            tag.as_ptr(),
+                            tag.len(),
+                            msg.as_ptr(),
+                            msg.len(),
+                        ),
+                        1
+                    );
+                }
+                assert_eq!(tagged.hash(&msg), expected);
+            }
+        }
+
+        let tag = TaggedHash::new(b"TapSighash");
+        let kp = KeyPair::from_seckey_slice(&secp, &[3; 32]).unwrap();
+        let (pk, _) = kp.x_only_public_key();
+        let sig = secp.sign_schnorr_tagged_with_aux_rand(&tag, b"tx", &kp, &[0; 32]);
+        assert!(secp.verify_schnorr_tagged(&sig, &tag, b"tx", &pk).is_ok());
+        assert!(secp.verify_schnorr(&sig, &tag.message(b"tx"), &pk).is_ok());
+        assert_eq!(
+            secp.verify_schnorr_tagged(&sig, &TaggedHash::new(b"TapLeaf"), b"tx", &pk),
+            Err(Error::InvalidSignature)
+        );
+    }
+
+    #[test]
+    #[cfg(not(fuzzing))] // fixed sig vectors can't work with fuzz-sigs
+    #[cfg(feature = "alloc")]
+    fn schnorr_verify_batch() {
+        let secp = Secp256k1::new();
+
+        let hex_msg = hex_32!("E48441762FB75010B2AA31A512B62B4148AA3FB08EB0765D76B252559064A614");
+        let msg = Message::from_slice(&hex_msg).unwrap();
+        let sig = Signature::from_str("6470FD1303DDA4FDA717B9837153C24A6EAB377183FC438F939E0ED2B620E9EE5077C4A8B8DCA28963D772A94F5F0DDF598E1C47C137F91933274C7C3EDADCE8").unwrap();
+        let pubkey = XOnlyPublicKey::from_str(
+            "B33CC9EDC096D0A83416964BD3C6247B8FECD256E4EFA7870D2C854BDEB33390",
+        )
+        .unwrap();
+
+        assert!(secp.verify_schnorr_batch(&[]).is_ok());
+        assert!(secp.verify_schnorr_batch(&[(msg, sig, pubkey)]).is_ok());
+
+        // Enough signatures to make the multi-scalar multiplication use Pippenger's algorithm.
+        let mut batch = vec![(msg, sig, pubkey)];
+        for (msg, sk) in batch_inputs(63) {
+            let kp = KeyPair::from_secret_key(&secp, &sk);
+            batch.push((msg, secp.sign_schnorr_no_aux_rand(&msg, &kp), kp.x_only_public_key().0));
+        }
+        assert!(secp.verify_schnorr_batch(&batch).is_ok());
+        // Challenges are hashed in groups of eight, the last one partially filled here.
+        assert!(secp.verify_schnorr_batch(&batch[..13]).is_ok());
+
+        // A scratch space too small for the whole batch splits the multiplication up.
+        let mut buf = [crate::AlignedType::ZERO; 1024];
+        let mut scratch = crate::scratch::ScratchSpace::preallocated_new(&mut buf).unwrap();
+        assert!(scratch.size() < batch_scratch_size(batch.len()));
+        for _ in 0..2 {
+            assert!(secp.verify_schnorr_batch_with_scratch(&batch, &mut scratch).is_ok());
+        }
+
+        let mut bad_sig = batch[17].1;
+        bad_sig.0[63] ^= 1;
+        batch[17].1 = bad_sig;
+        assert_eq!(secp.verify_schnorr_batch(&batch), Err(Error::InvalidSignature));
+
+        // A signature that is valid on its own but paired with the wrong message.
+        batch[17].1 = batch[18].1;
+        assert_eq!(secp.verify_schnorr_batch(&batch), Err(Error::InvalidSignature));
+    }
+
+    #[test]
+    #[cfg(feature = "alloc")]
+    fn schnorr_verify_prepared() {
+        let secp = Secp256k1::new();
+        // Covers keys whose full public key has odd as well as even Y coordinate.
+        for i in 1..32u8 {
+            let kp = KeyPair::from_seckey_slice(&secp, &[i; 32]).unwrap();
+            let pk = kp.x_only_public_key().0;
+            let prepared = PreparedXOnlyPublicKey::from(pk);
+            assert_eq!(prepared.public_key(), pk);
+
+            let msg = Message::from_slice(&[i.wrapping_mul(3); 32]).unwrap();
+            let sig = secp.sign_schnorr_no_aux_rand(&msg, &kp);
+            assert!(secp.verify_schnorr_prepared(&sig, &msg, &prepared).is_ok());
+
+            let other = Message::from_slice(&[!i; 32]).unwrap();
+            assert_eq!(
+                secp.verify_schnorr_prepared(&sig, &other, &prepared),
+                Err(Error::InvalidSignature)
+            );
+        }
+    }
+
     #[test]
     fn test_pubkey_from_slice() {
         assert_eq!(XOnlyPublicKey::from_slice(&[]), Err(InvalidPublicKey));
@@ -493,3 +885,56 @@ mod tests {
         assert_tokens(&pk.readable(), &[Token::String(PK_STR)]);
     }
 }
+
+#[cfg(bench)]
+#[cfg(feature = "rand-std")]
+mod benches {
+    use test::{black_box, Bencher};
+
+    use crate::{KeyPair, Message, Secp256k1};
+
+    #[bench]
+    pub fn bench_sign_schnorr(bh: &mut Bencher) {
+        let s = Secp256k1::new();
+        let msg = Message::from_slice(&crate::random_32_bytes(&mut rand::thread_rng())).unwrap();
+        let keypair = KeyPair::new(&s, &mut rand::thread_rng());
+
+        bh.iter(|| {
+            let sig = s.sign_schnorr_no_aux_rand(&msg, &keypair);
+            black_box(sig);
+        });
+    }
+
+    #[bench]
+    pub fn bench_verify_schnorr(bh: &mut Bencher) {
+        let s = Secp256k1::new();
+        let msg = Message::from_slice(&crate::random_32_bytes(&mut rand::thread_rng())).unwrap();
+        let keypair = KeyPair::new(&s, &mut rand::thread_rng());
+        let sig = s.sign_schnorr_no_aux_rand(&msg, &keypair);
+        let (pk, _) = keypair.x_only_public_key();
+
+        bh.iter(|| {
+            let res = s.verify_schnorr(&sig, &msg, &pk).unwrap();
+            black_box(res);
+        });
+    }
+
+    #[bench]
+    pub fn bench_verify_schnorr_batch(bh: &mut Bencher) {
+        let s = Secp256k1::new();
+        let batch: Vec<_> = (0..64)
+            .map(|_| {
+                let msg =
+                    Message::from_slice(&crate::random_32_bytes(&mut rand::thread_rng())).unwrap();
+                let keypair = KeyPair::new(&s, &mut rand::thread_rng());
+                let sig = s.sign_schnorr_no_aux_rand(&msg, &keypair);
+                (msg, sig, keypair.x_only_public_key().0)
+            })
+            .collect();
+
+        bh.iter(|| {
+            let res = s.verify_schnorr_batch(&batch).unwrap();
+            black_box(res);
+        });
+    }
+}
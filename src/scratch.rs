@@ -0,0 +1,198 @@
+//! Support for scratch spaces, the memory arenas used by batch operations.
+//!
+
+use core::marker::PhantomData;
+use core::ptr::NonNull;
+use core::{fmt, mem};
+
+#[cfg(feature = "alloc")]
+use crate::alloc::{vec, vec::Vec};
+use crate::ffi::types::{c_void, AlignedType};
+use crate::ffi::{self, CPtr};
+use crate::Error;
+
+/// A scratch space, the memory arena used by batch operations.
+///
+/// Batch operations such as [`Secp256k1::verify_schnorr_batch_with_scratch`] carve their
+/// temporary tables out of the scratch space and roll it back when they return, so a single
+/// scratch space can be reused across any number of calls without further allocation. It lives
+/// either in a caller supplied buffer ([`ScratchSpace::preallocated_new`]) or on the heap
+/// ([`ScratchSpace::new`]).
+///
+/// [`Secp256k1::verify_schnorr_batch_with_scratch`]: crate::Secp256k1::verify_schnorr_batch_with_scratch
+pub struct ScratchSpace<'buf> {
+    scratch: NonNull<ffi::ScratchSpace>,
+    size: usize,
+    #[cfg(feature = "alloc")]
+    _heap: Option<Vec<AlignedType>>,
+    phantom: PhantomData<&'buf mut [AlignedType]>,
+}
+
+// The scratch space exclusively owns the memory it points to.
+unsafe impl<'buf> Send for ScratchSpace<'buf> {}
+
+/// A checkpoint of a [`ScratchSpace`], see [`ScratchSpace::checkpoint`].
+#[derive(Copy, Clone, Debug, PartialEq, Eq, PartialOrd, Ord, Hash)]
+pub struct ScratchCheckpoint(usize);
+
+impl<'buf> ScratchSpace<'buf> {
+    /// Returns the number of [`AlignedType`] words a buffer passed to
+    /// [`ScratchSpace::preallocated_new`] needs for `size` bytes of scratch space.
+    pub fn preallocate_size(size: usize) -> usize {
+        let word_size = mem::size_of::<AlignedType>();
+        let bytes = unsafe { ffi::secp256k1_scratch_space_preallocated_size(size) };
+
+        (bytes + word_size - 1) / word_size
+    }
+
+    /// Creates a scratch space in a caller supplied buffer.
+    ///
+    /// All of `buf`, minus a few bytes of bookkeeping, is available to batch operations. Returns
+    /// [`Error::NotEnoughMemory`] if the buffer is too small to even hold the bookkeeping.
+    pub fn preallocated_new(buf: &'buf mut [AlignedType]) -> Result<ScratchSpace<'buf>, Error> {
+        let bytes = mem::size_of_val(buf);
+        let overhead = unsafe { ffi::secp256k1_scratch_space_preallocated_size(0) };
+        if bytes < overhead || buf.is_empty() {
+            return Err(Error::NotEnoughMemory);
+        }
+        let size = bytes - overhead;
+        // Safe because buf is not null since it is not empty.
+        let buf = unsafe { NonNull::new_unchecked(buf.as_mut_c_ptr() as *mut c_void) };
+
+        Ok(ScratchSpace {
+            scratch: unsafe {
+                ffi::secp256k1_scratch_space_preallocated_create(
+                    ffi::secp256k1_context_no_precomp,
+                    buf,
+                    size,
+                )
+            },
+            size,
+            #[cfg(feature = "alloc")]
+            _heap: None,
+            phantom: PhantomData,
+        })
+    }
+
+    /// Returns the number of bytes available to batch operations.
+    pub fn size(&self) -> usize { self.size }
+
+    /// Returns a checkpoint of the current state of the scratch space.
+    pub fn checkpoint(&self) -> ScratchCheckpoint {
+        ScratchCheckpoint(unsafe {
+            ffi::secp256k1_scratch_space_checkpoint(
+                ffi::secp256k1_context_no_precomp,
+                self.scratch.as_ptr(),
+            )
+        })
+    }
+
+    /// Rolls the scratch space back to `checkpoint`, releasing everything allocated since.
+    ///
+    /// # Panics
+    ///
+    /// If `checkpoint` was not taken from this scratch space or lies after its current state.
+    pub fn apply_checkpoint(&mut self, checkpoint: ScratchCheckpoint) {
+        assert!(
+            checkpoint <= self.checkpoint(),
+            "checkpoint does not belong to this scratch space"
+        );
+        unsafe {
+            ffi::secp256k1_scratch_space_apply_checkpoint(
+                ffi::secp256k1_context_no_precomp,
+                self.scratch.as_ptr(),
+                checkpoint.0,
+            );
+        }
+    }
+
+    /// Releases everything allocated from the scratch space.
+    pub fn reset(&mut self) { self.apply_checkpoint(ScratchCheckpoint(0)) }
+}
+
+#[cfg(feature = "alloc")]
+#[cfg_attr(docsrs, doc(cfg(feature = "alloc")))]
+impl ScratchSpace<'static> {
+    /// Creates a scratch space with `size` bytes available to batch operations on the heap.
+    pub fn new(size: usize) -> ScratchSpace<'static> {
+        let mut heap = vec![AlignedType::zeroed(); ScratchSpace::preallocate_size(size)];
+        // Moving the vector below does not move its heap buffer.
+        let buf = unsafe { NonNull::new_unchecked(heap.as_mut_c_ptr() as *mut c_void) };
+
+        ScratchSpace {
+            scratch: unsafe {
+                ffi::secp256k1_scratch_space_preallocated_create(
+                    ffi::secp256k1_context_no_precomp,
+                    buf,
+                    size,
+                )
+            },
+            size,
+            _heap: Some(heap),
+            phantom: PhantomData,
+        }
+    }
+}
+
+impl<'buf> CPtr for ScratchSpace<'buf> {
+    type Target = ffi::ScratchSpace;
+
+    fn as_c_ptr(&self) -> *const Self::Target { self.scratch.as_ptr() }
+
+    fn as_mut_c_ptr(&mut self) -> *mut Self::Target { self.scratch.as_ptr() }
+}
+
+impl<'buf> Drop for ScratchSpace<'buf> {
+    fn drop(&mut self) {
+        self.reset();
+        unsafe {
+            ffi::secp256k1_scratch_space_preallocated_destroy(
+                ffi::secp256k1_context_no_precomp,
+                self.scratch,
+            );
+        }
+    }
+}
+
+impl<'buf> fmt::Debug for ScratchSpace<'buf> {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        f.debug_struct("ScratchSpace").field("size", &self.size).finish()
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn preallocated_scratch_space() {
+        let mut buf = [AlignedType::ZERO; 64];
+        let scratch = ScratchSpace::preallocated_new(&mut buf).unwrap();
+        assert!(scratch.size() > 0);
+        assert!(ScratchSpace::preallocate_size(scratch.size()) <= 64);
+        assert_eq!(scratch.checkpoint(), ScratchCheckpoint(0));
+
+        assert_eq!(
+            ScratchSpace::preallocated_new(&mut []).map(|_| ()),
+            Err(Error::NotEnoughMemory)
+        );
+    }
+
+    #[test]
+    #[cfg(feature = "alloc")]
+    fn heap_scratch_space() {
+        let mut scratch = ScratchSpace::new(1024);
+        assert_eq!(scratch.size(), 1024);
+        let checkpoint = scratch.checkpoint();
+        scratch.apply_checkpoint(checkpoint);
+        scratch.reset();
+    }
+
+    #[test]
+    #[should_panic]
+    #[cfg(feature = "alloc")]
+    fn foreign_checkpoint() {
+        let mut scratch = ScratchSpace::new(1024);
+        scratch.apply_checkpoint(ScratchCheckpoint(16));
+    }
+}